@@ -10,6 +10,7 @@
 */
 
 #include "Dish.hpp"
+#include "KitchenStation.hpp"
 
 /**
      * Default constructor.
@@ -36,10 +37,44 @@ Dish::Dish(const std::string& name, const std::vector<Ingredient>& ingredients,
     setName(name);  // Use setName to validate the name
 }
 
+/**
+     * Copy constructor.
+     * @param other The dish to copy.
+     * @post The dish has the attributes of other, and is not assigned to any station.
+*/
+Dish::Dish(const Dish& other)
+    : name_(other.name_), ingredients_(other.ingredients_), prep_time_(other.prep_time_), price_(other.price_),
+      cuisine_type_(other.cuisine_type_) {}
+
+/**
+     * Copy assignment.
+     * @param other The dish to copy.
+     * @post The dish has the attributes of other, and stays assigned to the stations it was assigned to, which
+     * compile it again.
+*/
+Dish& Dish::operator=(const Dish& other) {
+    if (this != &other) {
+        name_ = other.name_;
+        ingredients_ = other.ingredients_;
+        prep_time_ = other.prep_time_;
+        price_ = other.price_;
+        cuisine_type_ = other.cuisine_type_;
+        notifyStations();
+    }
+    return *this;
+}
+
 /**
      * @return The name of the dish.
 */
 std::string Dish::getName() const {
+    return name_.str();
+}
+
+/**
+     * @return The name of the dish as an interned symbol, for comparing and hashing.
+*/
+Symbol Dish::getNameSymbol() const {
     return name_;
 }
 
@@ -50,6 +85,14 @@ std::vector<Ingredient> Dish::getIngredients() const {
     return ingredients_;
 }
 
+/**
+     * @return A reference to the list of ingredients used in the dish, without copying it. Valid until the
+     * ingredients are set or the dish is destroyed.
+*/
+const std::vector<Ingredient>& Dish::viewIngredients() const {
+    return ingredients_;
+}
+
 /**
      * @return The preparation time in minutes.
 */
@@ -79,26 +122,37 @@ std::string Dish::getCuisineType() const {
     }
 }
 
+/**
+     * @return True if the dish has been assigned to a kitchen station.
+*/
+bool Dish::isAssigned() const {
+    return !stations_.empty();
+}
+
 /**
      * Sets the name of the dish.
      * @param name A reference to the new name of the dish.
      * @post Sets the private member `name_` to the value of the parameter. If the name contains non-alphabetic characters, it is set to "UNKNOWN".
+     * The stations the dish is assigned to take orders for it under the new name.
 */
 void Dish::setName(const std::string& name) {
     if (isValidName(name)) {
-        name_ = name;
+        name_ = Symbol(name);
     } else {
-        name_ = "UNKNOWN";
+        name_ = Symbol("UNKNOWN");
     }
+    notifyStations();
 }
 
 /**
      * Sets the list of ingredients.
      * @param ingredients A reference to the new list of ingredients.
-     * @post Sets the private member `ingredients_` to the value of the parameter.
+     * @post Sets the private member `ingredients_` to the value of the parameter. The stations the dish is assigned
+     * to compile the new recipe.
 */
 void Dish::setIngredients(const std::vector<Ingredient>& ingredients) {
     ingredients_ = ingredients;
+    notifyStations();
 }
 
 /**
@@ -142,6 +196,15 @@ bool Dish::isValidName(const std::string& name) const {
     return true;  // Name is valid
 }
 
+/**
+     * Has the stations the dish is assigned to compile it again, after its name or ingredients changed.
+*/
+void Dish::notifyStations() {
+    for (KitchenStation* station : stations_) {
+        station->recompileRecipes();
+    }
+}
+
 /**
      @param : A const reference to the right-hand side of the `==` operator.
     @return : Returns true if the right-hand side dish is "equal", false
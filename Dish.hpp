@@ -4,7 +4,8 @@
  *
  * The Dish class includes attributes such as name, ingredients, preparation time, price, and cuisine type.
  * It provides constructors, accessor and mutator functions, and a display function to manage and present
- * the details of a dish.
+ * the details of a dish. A kitchen station compiles a dish's name and ingredients when the dish is assigned to it;
+ * changing either afterwards has the station compile them again.
  *
  * @date 10/31/2024
  * @author Mitchell Lipyansky
@@ -18,12 +19,15 @@
 #include <iostream>
 #include <iomanip> // For std::fixed and std::setprecision
 #include <cctype>  // For std::isalpha, std::isspace
+#include "Symbol.hpp"
+
+class KitchenStation;
 
 /**
     * Struct representing an ingredient.
 */
 struct Ingredient {
-    std::string name;
+    Symbol name; // Interned; assigned, read and concatenated like a std::string
     int quantity; // Quantity in stock
     int required_quantity; // Quantity required for a dish
     double price; // Price per unit
@@ -73,17 +77,43 @@ public:
      */
     Dish(const std::string& name, const std::vector<Ingredient>& ingredients = {}, int prep_time = 0, double price = 0.0, CuisineType cuisine_type = CuisineType::OTHER);
 
+    /**
+     * Copy constructor.
+     * @param other The dish to copy.
+     * @post The dish has the attributes of other, and is not assigned to any station.
+     */
+    Dish(const Dish& other);
+
+    /**
+     * Copy assignment.
+     * @param other The dish to copy.
+     * @post The dish has the attributes of other, and stays assigned to the stations it was assigned to, which
+     * compile it again.
+     */
+    Dish& operator=(const Dish& other);
+
     // Accessors
     /**
      * @return The name of the dish.
      */
     std::string getName() const;
 
+    /**
+     * @return The name of the dish as an interned symbol, for comparing and hashing.
+     */
+    Symbol getNameSymbol() const;
+
     /**
      * @return The list of ingredients used in the dish.
      */
     std::vector<Ingredient> getIngredients() const;
 
+    /**
+     * @return A reference to the list of ingredients used in the dish, without copying it. Valid until the
+     * ingredients are set or the dish is destroyed.
+     */
+    const std::vector<Ingredient>& viewIngredients() const;
+
     /**
      * @return The preparation time in minutes.
      */
@@ -99,18 +129,25 @@ public:
      */
     std::string getCuisineType() const;
 
+    /**
+     * @return True if the dish has been assigned to a kitchen station.
+     */
+    bool isAssigned() const;
+
     // Mutators
     /**
      * Sets the name of the dish.
      * @param name A reference to the new name of the dish.
      * @post Sets the private member `name_` to the value of the parameter. If the name contains non-alphabetic characters, it is set to "UNKNOWN".
+     * The stations the dish is assigned to take orders for it under the new name.
      */
     void setName(const std::string& name);
 
     /**
      * Sets the list of ingredients.
      * @param ingredients A reference to the new list of ingredients.
-     * @post Sets the private member `ingredients_` to the value of the parameter.
+     * @post Sets the private member `ingredients_` to the value of the parameter. The stations the dish is assigned
+     * to compile the new recipe.
      */
     void setIngredients(const std::vector<Ingredient>& ingredients);
 
@@ -155,11 +192,19 @@ public:
 
 
 private:
-    std::string name_;
+    friend class KitchenStation; // Records the dishes assigned to it
+
+    Symbol name_; // Interned
     std::vector<Ingredient> ingredients_; // List of required ingredients
     int prep_time_;
     double price_;
     CuisineType cuisine_type_;
+    std::vector<KitchenStation*> stations_; // The stations the dish is assigned to, which compiled it
+
+    /**
+     * Has the stations the dish is assigned to compile it again, after its name or ingredients changed.
+     */
+    void notifyStations();
 
     // Helper function to check if the name is valid
     /**
@@ -0,0 +1,341 @@
+/** ADT list: hashed implementation.
+
+ Implementation file for the class HashedList.
+ @file HashedList.cpp */
+
+#include "HashedList.hpp"  // Header file
+#include <string>
+#include <utility>
+
+// constructor
+template<class T, class Hash>
+HashedList<T, Hash>::HashedList()
+{
+}  // end default constructor
+
+
+/**@return true if list is empty - getLength() == 0 */
+template<class T, class Hash>
+bool HashedList<T, Hash>::isEmpty() const
+{
+   return order_.empty();
+}  // end isEmpty
+
+
+/**@return the number of items in the list */
+template<class T, class Hash>
+int HashedList<T, Hash>::getLength() const
+{
+   return static_cast<int>(order_.size());
+}  // end getLength
+
+
+/**
+ @pre list positions follow traditional indexing from 0 to getLength() -1
+ @param position indicating point of insertion
+ @param new_entry to be inserted in list
+ @post new_entry is added at position in list (the entry previously at that position is now at position+1)
+ @return true if valid position (0 <= position <= getLength()) and new_entry is not in the list already */
+template<class T, class Hash>
+bool HashedList<T, Hash>::insert(int position, const T& new_entry)
+{
+   bool ableToInsert = (position >= 0) && (position <= getLength());
+   if (ableToInsert)
+      ableToInsert = place(std::next(order_.begin(), position), new_entry) != end();
+   return ableToInsert;
+}  // end insert
+
+
+template<class T, class Hash>
+bool HashedList<T, Hash>::insert(int position, T&& new_entry)
+{
+   bool ableToInsert = (position >= 0) && (position <= getLength());
+   if (ableToInsert)
+      ableToInsert = place(std::next(order_.begin(), position), std::move(new_entry)) != end();
+   return ableToInsert;
+}  // end insert
+
+
+/**
+ @pre list positions follow traditional indexing from 0 to getLength() -1
+ @param position indicating point of insertion
+ @param args forwarded to the constructor of T
+ @post an entry constructed from args is added at position in list
+ @return true if valid position (0 <= position <= getLength()) and the entry is not in the list already */
+template<class T, class Hash>
+template<class... Args>
+bool HashedList<T, Hash>::emplace(int position, Args&&... args)
+{
+   // the entry must exist before it can be hashed
+   return insert(position, T(std::forward<Args>(args)...));
+}  // end emplace
+
+
+/**
+ @param new_entry to be inserted in list
+ @post new_entry is added at the end of the list, in O(log n) time, unless it is in the list already */
+template<class T, class Hash>
+void HashedList<T, Hash>::pushBack(const T& new_entry)
+{
+   place(order_.end(), new_entry);
+}  // end pushBack
+
+
+template<class T, class Hash>
+void HashedList<T, Hash>::pushBack(T&& new_entry)
+{
+   place(order_.end(), std::move(new_entry));
+}  // end pushBack
+
+
+/**
+ @param new_entry to be inserted in list
+ @post new_entry is added at the beginning of the list, in O(log n) time, unless it is in the list already */
+template<class T, class Hash>
+void HashedList<T, Hash>::pushFront(const T& new_entry)
+{
+   place(order_.begin(), new_entry);
+}  // end pushFront
+
+
+template<class T, class Hash>
+void HashedList<T, Hash>::pushFront(T&& new_entry)
+{
+   place(order_.begin(), std::move(new_entry));
+}  // end pushFront
+
+
+/**
+ @pre list positions follow traditional indexing from 0 to getLength() -1
+ @param position indicating point of deletion
+ @post entry at position is deleted, if any. List order is retained
+ @return true if there is an entry at position to be deleted, false otherwise */
+template<class T, class Hash>
+bool HashedList<T, Hash>::remove(int position)
+{
+   bool ableToRemove = (position >= 0) && (position < getLength());
+   if (ableToRemove)
+      erase(std::next(begin(), position));
+   return ableToRemove;
+}  // end remove
+
+
+/**@post the list is empty and getLength() == 0*/
+template<class T, class Hash>
+void HashedList<T, Hash>::clear()
+{
+   order_.clear();
+   sequence_of_.clear();
+}  // end clear
+
+
+/**
+ @pre list positions follow traditional indexing from 0 to getLength() -1
+ @param position indicating the position of the data to be retrieved
+ @return reference to the data item found at position, in linear time.
+        If position is not a valid position < getLength() throws  PrecondViolatedExcep */
+template<class T, class Hash>
+const T& HashedList<T, Hash>::getEntry(int position) const
+{
+   // Enforce precondition
+   bool ableToGet = (position >= 0) && (position < getLength());
+   if (ableToGet)
+   {
+      return std::next(order_.begin(), position)->second;
+   }
+   else
+   {
+      std::string message = "getEntry() called with an empty list or ";
+      message  = message + "invalid position.";
+      throw(PrecondViolatedExcep(message));
+   }  // end if
+}  // end getEntry
+
+
+/**@return iterator to the first entry, equal to end() if the list is empty */
+template<class T, class Hash>
+typename HashedList<T, Hash>::iterator HashedList<T, Hash>::begin()
+{
+   return iterator(this, order_.begin());
+}  // end begin
+
+
+template<class T, class Hash>
+typename HashedList<T, Hash>::const_iterator HashedList<T, Hash>::begin() const
+{
+   return const_iterator(this, order_.begin());
+}  // end begin
+
+
+template<class T, class Hash>
+typename HashedList<T, Hash>::const_iterator HashedList<T, Hash>::cbegin() const
+{
+   return begin();
+}  // end cbegin
+
+
+/**@return iterator one past the last entry */
+template<class T, class Hash>
+typename HashedList<T, Hash>::iterator HashedList<T, Hash>::end()
+{
+   return iterator(this, order_.end());
+}  // end end
+
+
+template<class T, class Hash>
+typename HashedList<T, Hash>::const_iterator HashedList<T, Hash>::end() const
+{
+   return const_iterator(this, order_.end());
+}  // end end
+
+
+template<class T, class Hash>
+typename HashedList<T, Hash>::const_iterator HashedList<T, Hash>::cend() const
+{
+   return end();
+}  // end cend
+
+
+/**
+ @param entry to be searched for
+ @return iterator to entry, end() if it is not in the list. O(log n) time,
+         the list is never walked */
+template<class T, class Hash>
+typename HashedList<T, Hash>::iterator HashedList<T, Hash>::find(const T& entry)
+{
+   auto found = sequence_of_.find(entry);
+   return found != sequence_of_.end() ? iterator(this, order_.find(found->second)) : end();
+}  // end find
+
+
+template<class T, class Hash>
+typename HashedList<T, Hash>::const_iterator HashedList<T, Hash>::find(const T& entry) const
+{
+   auto found = sequence_of_.find(entry);
+   return found != sequence_of_.end() ? const_iterator(this, order_.find(found->second)) : end();
+}  // end find
+
+
+/**
+ @pre position refers to an entry of this list (it is not end())
+ @param position iterator to the entry to be deleted
+ @post the entry is deleted in O(log n) time. Only iterators to the deleted
+       entry are invalidated
+ @return iterator to the entry that followed the deleted one */
+template<class T, class Hash>
+typename HashedList<T, Hash>::iterator HashedList<T, Hash>::erase(iterator position)
+{
+   sequence_of_.erase(*position);
+   return iterator(this, order_.erase(position.order_it_));
+}  // end erase
+
+
+/**
+ @pre position refers to an entry of this list (it is not end())
+ @param position iterator to the entry to be moved
+ @post the entry takes a sequence number before the first one, in O(log n)
+       time and without allocating. Only iterators to the moved entry are invalidated
+ @return iterator to the moved entry, now equal to begin() */
+template<class T, class Hash>
+typename HashedList<T, Hash>::iterator HashedList<T, Hash>::moveToFront(iterator position)
+{
+   if (position.order_it_ == order_.begin())
+      return position;
+   return relink(position.order_it_, order_.begin());
+}  // end moveToFront
+
+
+/**
+ @pre position and source refer to entries of this list (neither is end())
+ @param position iterator to the entry after which to move
+ @param source iterator to the entry to be moved
+ @post the entry of source takes a sequence number right after the one of position,
+       in O(log n) time unless the list has to be renumbered. Iterators to the
+       moved entry are invalidated, and all of them if the list is renumbered
+ @return iterator to the moved entry */
+template<class T, class Hash>
+typename HashedList<T, Hash>::iterator HashedList<T, Hash>::spliceAfter(iterator position, iterator source)
+{
+   auto before = std::next(position.order_it_);
+   if (position == source || before == source.order_it_)
+      return source;
+   return relink(source.order_it_, before);
+}  // end spliceAfter
+
+
+
+/************* PRIVATE METHODS ************/
+
+
+// @param before the entry the new sequence number must precede, order_.end() for the back.
+//        Refreshed if the list has to be renumbered to make room
+// @return a sequence number that is not in use, between before and the entry preceding it
+template<class T, class Hash>
+typename HashedList<T, Hash>::Sequence HashedList<T, Hash>::sequenceBefore(typename Order::iterator& before)
+{
+   if (order_.empty())
+      return 0;
+   if (before == order_.begin())
+      return before->first - STRIDE;
+   if (before == order_.end())
+      return std::prev(before)->first + STRIDE;
+
+   if (before->first - std::prev(before)->first < 2)
+   {
+      // No room left between the neighbours. The entry itself survives the renumbering, its iterator may not
+      const T* anchor = &before->second;
+      renumber();
+      before = order_.find(sequence_of_.find(*anchor)->second);
+   }
+   Sequence previous = std::prev(before)->first;
+   return previous + (before->first - previous) / 2;
+}  // end sequenceBefore
+
+
+// @post the entries are numbered 0, STRIDE, 2 * STRIDE, ... in list order
+template<class T, class Hash>
+void HashedList<T, Hash>::renumber()
+{
+   Order renumbered;
+   Sequence sequence = 0;
+   while (!order_.empty())
+   {
+      auto node = order_.extract(order_.begin());  // Relinks the map node, no allocation
+      node.key() = sequence;
+      sequence_of_.find(node.mapped())->second = sequence;
+      renumbered.insert(renumbered.end(), std::move(node));
+      sequence += STRIDE;
+   }
+   order_.swap(renumbered);
+}  // end renumber
+
+
+// Adds a new entry right before another one.
+// @param before the entry to precede, order_.end() for the back
+// @return iterator to the new entry, end() if it was in the list already
+template<class T, class Hash>
+template<class Entry>
+typename HashedList<T, Hash>::iterator HashedList<T, Hash>::place(typename Order::iterator before, Entry&& new_entry)
+{
+   if (sequence_of_.find(new_entry) != sequence_of_.end())
+      return end();
+
+   Sequence sequence = sequenceBefore(before);
+   auto placed = order_.emplace_hint(before, sequence, std::forward<Entry>(new_entry));
+   sequence_of_.emplace(placed->second, sequence);
+   return iterator(this, placed);
+}  // end place
+
+
+// Moves an entry of the list right before another one.
+// @pre entry != before
+// @return iterator to the moved entry
+template<class T, class Hash>
+typename HashedList<T, Hash>::iterator HashedList<T, Hash>::relink(typename Order::iterator entry, typename Order::iterator before)
+{
+   auto node = order_.extract(entry);  // Keeps the map node, no allocation
+   Sequence sequence = sequenceBefore(before);
+   node.key() = sequence;
+   sequence_of_.find(node.mapped())->second = sequence;
+   return iterator(this, order_.insert(before, std::move(node)));
+}  // end relink
@@ -0,0 +1,234 @@
+/** ADT list: hashed implementation.
+    Every entry carries a sequence number that fixes its place in the list. The
+    entries are kept in a map ordered by sequence number and a hash table maps
+    each entry back to its sequence number, so find, erase, moveToFront and
+    spliceAfter never walk the list. Sequence numbers are spread out, so a moved
+    entry usually takes a free number between its new neighbours; the list is
+    renumbered only when two neighbours run out of room.
+    Entries are unique and cannot be modified through an iterator, since they are
+    the keys of the hash table; iter_swap(a, b) swaps two of them in place.
+    The interface mirrors LinkedList, so the two can be swapped at compile time.
+    @file HashedList.hpp */
+
+#ifndef HASHED_LIST_
+#define HASHED_LIST_
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include "PrecondViolatedExcep.hpp"
+
+/** @param T type of the entries, which must be unique
+    @param Hash hashes an entry */
+template<class T, class Hash = std::hash<T>>
+class HashedList
+{
+   using Sequence = long long;
+   using Order = std::map<Sequence, T>;
+
+public:
+   static constexpr Sequence STRIDE = Sequence(1) << 20; // Gap left between neighbours when numbering
+
+   /** Forward iterator over the entries of the list, in list order.
+       @param IsConst true for const_iterator, false for iterator */
+   template<bool IsConst>
+   class ListIterator
+   {
+   public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = T;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const T*;
+      using reference = const T&;
+
+      ListIterator() : list_(nullptr) {}
+
+      // an iterator converts to a const_iterator, never the other way around
+      template<bool WasConst, class = std::enable_if_t<IsConst && !WasConst>>
+      ListIterator(const ListIterator<WasConst>& other) : list_(other.list_), order_it_(other.order_it_) {}
+
+      reference operator*() const { return order_it_->second; }
+      pointer operator->() const { return &order_it_->second; }
+
+      ListIterator& operator++()
+      {
+         ++order_it_;
+         return *this;
+      }
+
+      ListIterator operator++(int)
+      {
+         ListIterator old = *this;
+         ++(*this);
+         return old;
+      }
+
+      friend bool operator==(const ListIterator& lhs, const ListIterator& rhs)
+      {
+         return lhs.order_it_ == rhs.order_it_;
+      }
+
+      friend bool operator!=(const ListIterator& lhs, const ListIterator& rhs)
+      {
+         return lhs.order_it_ != rhs.order_it_;
+      }
+
+      /** Swaps the entries at two positions, found by argument-dependent lookup
+          the way std::iter_swap is used, and keeps the hash table in step */
+      friend void iter_swap(ListIterator lhs, ListIterator rhs)
+      {
+         swapEntries(lhs, rhs);
+      }
+
+   private:
+      friend class HashedList<T, Hash>;
+      template<bool> friend class ListIterator;
+
+      using ListPtr = std::conditional_t<IsConst, const HashedList*, HashedList*>;
+      using OrderIterator = std::conditional_t<IsConst, typename Order::const_iterator, typename Order::iterator>;
+
+      ListIterator(ListPtr list, OrderIterator order_it) : list_(list), order_it_(order_it) {}
+
+      static void swapEntries(ListIterator lhs, ListIterator rhs)
+      {
+         static_assert(!IsConst, "cannot swap through a const_iterator");
+         std::swap(lhs.order_it_->second, rhs.order_it_->second);
+         lhs.list_->sequence_of_[lhs.order_it_->second] = lhs.order_it_->first;
+         rhs.list_->sequence_of_[rhs.order_it_->second] = rhs.order_it_->first;
+      }
+
+      ListPtr list_;           // list the entry belongs to
+      OrderIterator order_it_; // entry in the order map, order_.end() past the last one
+   }; // end ListIterator
+
+   using iterator = ListIterator<false>;
+   using const_iterator = ListIterator<true>;
+
+   HashedList(); // constructor
+
+   /**@return true if list is empty - getLength() == 0 */
+   bool isEmpty() const;
+
+   /**@return the number of items in the list */
+   int getLength() const;
+
+    /**
+     @pre list positions follow traditional indexing from 0 to getLength() -1
+     @param position indicating point of insertion
+     @param new_entry to be inserted in list
+     @post new_entry is added at position in list (the entry previously at that position is now at position+1)
+     @return true if valid position (0 <= position <= getLength()) and new_entry is not in the list already */
+   bool insert(int position, const T& new_entry);
+   bool insert(int position, T&& new_entry);
+
+    /**
+     @pre list positions follow traditional indexing from 0 to getLength() -1
+     @param position indicating point of insertion
+     @param args forwarded to the constructor of T
+     @post an entry constructed from args is added at position in list
+     @return true if valid position (0 <= position <= getLength()) and the entry is not in the list already */
+   template<class... Args>
+   bool emplace(int position, Args&&... args);
+
+    /**
+     @param new_entry to be inserted in list
+     @post new_entry is added at the end of the list, in O(log n) time, unless it is in the list already */
+   void pushBack(const T& new_entry);
+   void pushBack(T&& new_entry);
+
+    /**
+     @param new_entry to be inserted in list
+     @post new_entry is added at the beginning of the list, in O(log n) time, unless it is in the list already */
+   void pushFront(const T& new_entry);
+   void pushFront(T&& new_entry);
+
+    /**
+     @pre list positions follow traditional indexing from 0 to getLength() -1
+     @param position indicating point of deletion
+     @post entry at position is deleted, if any. List order is retained
+     @return true if there is an entry at position to be deleted, false otherwise */
+   bool remove(int position);
+
+   /**@post the list is empty and getLength() == 0*/
+   void clear();
+
+    /**
+     @pre list positions follow traditional indexing from 0 to getLength() -1
+     @param position indicating the position of the data to be retrieved
+     @return reference to the data item found at position, in linear time.
+            If position is not a valid position < getLength() throws  PrecondViolatedExcep */
+   const T& getEntry(int position) const;
+
+   /**@return iterator to the first entry, equal to end() if the list is empty */
+   iterator begin();
+   const_iterator begin() const;
+   const_iterator cbegin() const;
+
+   /**@return iterator one past the last entry */
+   iterator end();
+   const_iterator end() const;
+   const_iterator cend() const;
+
+    /**
+     @param entry to be searched for
+     @return iterator to entry, end() if it is not in the list. O(log n) time,
+             the list is never walked */
+   iterator find(const T& entry);
+   const_iterator find(const T& entry) const;
+
+    /**
+     @pre position refers to an entry of this list (it is not end())
+     @param position iterator to the entry to be deleted
+     @post the entry is deleted in O(log n) time. Only iterators to the deleted
+           entry are invalidated
+     @return iterator to the entry that followed the deleted one */
+   iterator erase(iterator position);
+
+    /**
+     @pre position refers to an entry of this list (it is not end())
+     @param position iterator to the entry to be moved
+     @post the entry takes a sequence number before the first one, in O(log n)
+           time and without allocating. Only iterators to the moved entry are invalidated
+     @return iterator to the moved entry, now equal to begin() */
+   iterator moveToFront(iterator position);
+
+    /**
+     @pre position and source refer to entries of this list (neither is end())
+     @param position iterator to the entry after which to move
+     @param source iterator to the entry to be moved
+     @post the entry of source takes a sequence number right after the one of position,
+           in O(log n) time unless the list has to be renumbered. Iterators to the
+           moved entry are invalidated, and all of them if the list is renumbered
+     @return iterator to the moved entry */
+   iterator spliceAfter(iterator position, iterator source);
+
+private:
+   Order order_; // Sequence number -> entry, in list order
+   std::unordered_map<T, Sequence, Hash> sequence_of_; // Entry -> its sequence number
+
+   // @param before the entry the new sequence number must precede, order_.end() for the back.
+   //        Refreshed if the list has to be renumbered to make room
+   // @return a sequence number that is not in use, between before and the entry preceding it
+   Sequence sequenceBefore(typename Order::iterator& before);
+
+   // @post the entries are numbered 0, STRIDE, 2 * STRIDE, ... in list order
+   void renumber();
+
+   // Adds a new entry right before another one.
+   // @param before the entry to precede, order_.end() for the back
+   // @return iterator to the new entry, end() if it was in the list already
+   template<class Entry>
+   iterator place(typename Order::iterator before, Entry&& new_entry);
+
+   // Moves an entry of the list right before another one.
+   // @pre entry != before
+   // @return iterator to the moved entry
+   iterator relink(typename Order::iterator entry, typename Order::iterator before);
+}; // end HashedList
+
+#include "HashedList.cpp"
+#endif
@@ -10,20 +10,26 @@
 */
 
 #include "KitchenStation.hpp"
-#include <algorithm>  // For std::remove
+#include <algorithm>  // For std::min
+#include <limits>
+#include <utility>    // For std::move
 
 /**
  * Default Constructor
  * @post: Initializes an empty kitchen station with default values.
 */
-KitchenStation::KitchenStation() : station_name_("UNKNOWN") {}
+KitchenStation::KitchenStation()
+    : station_name_("UNKNOWN"), stock_capacity_(0), stock_head_(NOT_STOCKED), stock_tail_(NOT_STOCKED), in_stock_count_(0),
+      filter_lookups_(0), filter_rejected_(0), filter_false_positives_(0), concurrency_mode_(SINGLE_THREADED) {}
 
 /**
  * Parameterized Constructor
  * @param station_name A string representing the station's name.
  * @post: Initializes a kitchen station with the given name.
 */
-KitchenStation::KitchenStation(const std::string& station_name) : station_name_(station_name) {}
+KitchenStation::KitchenStation(const std::string& station_name)
+    : station_name_(station_name), stock_capacity_(0), stock_head_(NOT_STOCKED), stock_tail_(NOT_STOCKED), in_stock_count_(0),
+      filter_lookups_(0), filter_rejected_(0), filter_false_positives_(0), concurrency_mode_(SINGLE_THREADED) {}
 
 /**
  * Destructor
@@ -41,16 +47,75 @@ KitchenStation::~KitchenStation() {
  * @return: The name of the station.
 */
 std::string KitchenStation::getName() const {
+    auto lock = readLock();
+    return station_name_.str();
+}
+
+/**
+ * @return: The name of the station as an interned symbol, for comparing and hashing.
+*/
+Symbol KitchenStation::getNameSymbol() const {
+    auto lock = readLock();
     return station_name_;
 }
 
 /**
  * Sets the name of the kitchen station.
  * @param name A string representing the new station name.
- * @post: Updates the station's name.
+ * @post: Updates the station's name, unless the rename listener vetoes it.
+ * @return: True if the name was updated; false otherwise.
+*/
+bool KitchenStation::setName(const std::string& name) {
+    std::function<bool(const KitchenStation&, const std::string&)> listener;
+    {
+        auto lock = readLock();
+        listener = rename_listener_;
+    }
+    // Consulted unlocked: it reads the station, and a manager's listener takes the manager's lock, which is always
+    // taken before a station's
+    if (listener && !listener(*this, name)) {
+        return false;
+    }
+    const Symbol symbol(name);
+    auto lock = writeLock();
+    station_name_ = symbol;
+    return true;
+}
+
+/**
+ * Registers the callback consulted before the station is renamed.
+ * @param listener Called with the station (still under its old name) and the requested name; returning false
+vetoes the rename. An empty function removes the listener.
+ * @post: Replaces any previously registered listener.
+*/
+void KitchenStation::setRenameListener(std::function<bool(const KitchenStation&, const std::string&)> listener) {
+    auto lock = writeLock();
+    rename_listener_ = std::move(listener);
+}
+
+/**
+ * Registers the callback told when the station starts or stops taking orders for a dish name.
+ * @param listener Called with the station, the name and whether the station now carries it: once the first dish of
+that name is assigned, and when a dish is renamed or changed. It is called with the station unlocked, so it may take
+the lock of the station's manager. An empty function removes the listener.
+ * @post: Replaces any previously registered listener.
+*/
+void KitchenStation::setMenuListener(std::function<void(const KitchenStation&, Symbol, bool)> listener) {
+    auto lock = writeLock();
+    menu_listener_ = std::move(listener);
+}
+
+/**
+ * Registers the callback told when a dish becomes available or unavailable.
+ * @param listener Called with the station, the dish and whether it is now available, each time a dish joins or
+leaves the available dishes (including when it is assigned already available). It must not modify the station, and
+in LOCKED mode it is called with the station locked, so it must not call the station at all. An empty function
+removes the listener.
+ * @post: Replaces any previously registered listener.
 */
-void KitchenStation::setName(const std::string& name) {
-    station_name_ = name;
+void KitchenStation::setAvailabilityListener(std::function<void(const KitchenStation&, Dish*, bool)> listener) {
+    auto lock = writeLock();
+    availability_listener_ = std::move(listener);
 }
 
 /**
@@ -58,27 +123,181 @@ void KitchenStation::setName(const std::string& name) {
  * @return A vector of pointers to Dish objects assigned to the station.
 */
 std::vector<Dish*> KitchenStation::getDishes() const {
+    auto lock = readLock();
     return dishes_;
 }
 
+/**
+ * Views the dishes assigned to the kitchen station without copying them.
+ * @return A reference to the station's list of dishes, valid until a dish is assigned or the station is destroyed.
+*/
+const std::vector<Dish*>& KitchenStation::viewDishes() const {
+    return dishes_;
+}
+
+/**
+ * Retrieves the names the station takes orders for.
+ * @return The name of each dish as it was when first assigned under it, in the order they were assigned.
+*/
+std::vector<Symbol> KitchenStation::getDishNames() const {
+    auto lock = readLock();
+    std::vector<Symbol> names(recipes_.size());
+    for (const auto& entry : recipe_index_) {
+        names[entry.second] = entry.first;
+    }
+    return names;
+}
+
 /**
  * Retrieves the ingredient stock available at the kitchen station.
 * @return A vector of Ingredient objects representing the station's
-ingredient stock.
+ingredient stock, in the order the ingredients were stocked. Ingredients that ran out are not listed; restocking
+one lists it last.
 */
 std::vector<Ingredient> KitchenStation::getIngredientsStock() const {
-    return ingredients_stock_;
+    auto lock = readLock();
+    if (concurrency_mode_ != LOCK_FREE) {
+        StockView stock = viewIngredientsStock();
+        return std::vector<Ingredient>(stock.begin(), stock.end());
+    }
+    // The links lag behind the counters: listed as syncStock would link them
+    std::vector<Ingredient> stock;
+    for (std::size_t slot = stock_head_; slot != NOT_STOCKED; slot = stock_next_[slot]) {
+        if (int quantity = loadQuantity(slot); quantity > 0) {
+            stock.push_back(ingredients_stock_[slot]);
+            stock.back().quantity = quantity;
+        }
+    }
+    for (std::size_t slot = 0; slot < ingredients_stock_.size(); slot++) {
+        if (int quantity = loadQuantity(slot); quantity > 0 && !isLinked(slot)) {
+            stock.push_back(ingredients_stock_[slot]);
+            stock.back().quantity = quantity;
+        }
+    }
+    return stock;
+}
+
+/**
+ * Views the ingredient stock available at the kitchen station without copying it.
+ * @return A range over the same ingredients as getIngredientsStock, in the same order, valid until the stock changes.
+*/
+KitchenStation::StockView KitchenStation::viewIngredientsStock() const {
+    return StockView(this);
+}
+
+/**
+ * Sets how the station synchronizes the threads that use it.
+ * @param mode The new ConcurrencyMode (SINGLE_THREADED by default).
+ * @pre: No other thread is using the station.
+ * @post: Later calls synchronize according to the mode. The views (viewDishes, viewIngredientsStock) are never
+synchronized: read them only while no other thread changes the station, and not in LOCK_FREE mode, whose stock order
+lags behind the counters.
+*/
+void KitchenStation::setConcurrencyMode(ConcurrencyMode mode) {
+    if (concurrency_mode_ == LOCK_FREE && mode != LOCK_FREE) {
+        syncStock();
+    }
+    concurrency_mode_ = mode;
+}
+
+/**
+ * @return: How the station synchronizes the threads that use it.
+*/
+KitchenStation::ConcurrencyMode KitchenStation::getConcurrencyMode() const {
+    return concurrency_mode_;
+}
+
+/**
+ * @return: An iterator to the ingredient stocked first.
+*/
+KitchenStation::StockView::const_iterator KitchenStation::StockView::begin() const {
+    return const_iterator(station_, station_->stock_head_);
+}
+
+/**
+ * @return: An iterator past the ingredient stocked last.
+*/
+KitchenStation::StockView::const_iterator KitchenStation::StockView::end() const {
+    return const_iterator(station_, NOT_STOCKED);
+}
+
+/**
+ * @return: The number of ingredients in stock.
+*/
+std::size_t KitchenStation::StockView::size() const {
+    return station_->in_stock_count_;
+}
+
+/**
+ * @return: The ingredient, with its current quantity.
+*/
+Ingredient KitchenStation::StockView::const_iterator::operator*() const {
+    Ingredient ingredient = station_->ingredients_stock_[slot_];
+    ingredient.quantity = station_->loadQuantity(slot_);
+    return ingredient;
+}
+
+/**
+ * @post: The iterator moves to the ingredient stocked next.
+ * @return: The iterator.
+*/
+KitchenStation::StockView::const_iterator& KitchenStation::StockView::const_iterator::operator++() {
+    slot_ = station_->stock_next_[slot_];
+    return *this;
+}
+
+/**
+ * @post: The iterator moves to the ingredient stocked next.
+ * @return: A copy of the iterator from before the move.
+*/
+KitchenStation::StockView::const_iterator KitchenStation::StockView::const_iterator::operator++(int) {
+    const_iterator before = *this;
+    ++*this;
+    return before;
 }
 
 /**
  * Assigns a dish to the station.
  * @param dish A pointer to a Dish object.
  * @post: Adds the dish to the station's list of dishes if not
-already present.
+already present, and compiles its recipe against the stock. Changing the dish's name or ingredients later has the
+station compile it again. Orders for a name go to the first dish assigned under it. The menu listener is told of a
+name the station did not carry yet.
  * @return: True if the dish was added successfully; false
 otherwise.
 */
 bool KitchenStation::assignDishToStation(Dish* dish) {
+    std::function<void(const KitchenStation&, Symbol, bool)> listener;
+    {
+        auto lock = writeLock();
+        const std::size_t names = recipes_.size();
+        if (!addDish(dish)) {
+            return false;
+        }
+        if (recipes_.size() == names) {
+            return true;  // Earlier dishes keep their name
+        }
+        listener = menu_listener_;
+    }
+    // Told unlocked, as setName consults its listener: a manager's listener takes the manager's lock, which is always
+    // taken before a station's
+    if (listener) {
+        listener(*this, dish->getNameSymbol(), true);
+    }
+    return true;
+}
+
+/**
+ * Adds a dish to the station and compiles its recipe.
+ * @param dish A pointer to a Dish object.
+ * @pre: The station is locked exclusively, or used by one thread.
+ * @post: As assignDishToStation, without telling the menu listener.
+ * @return: True if the dish was added; false if it was already assigned.
+*/
+bool KitchenStation::addDish(Dish* dish) {
+    if (concurrency_mode_ == LOCK_FREE) {
+        syncStock();  // The new recipe's availability is kept from its short count on
+    }
     // Check if dish already assigned
     for (auto assigned_dish : dishes_) {
         if (assigned_dish == dish) {
@@ -86,51 +305,192 @@ bool KitchenStation::assignDishToStation(Dish* dish) {
         }
     }
     dishes_.push_back(dish);  // Add dish to the list
+    dish->stations_.push_back(this);  // So that a change to the dish reaches its recipe
+    compileDish(dish);
     return true;
 }
 
+/**
+ * Compiles the recipe of an assigned dish, unless an earlier dish has its name.
+ * @param dish A pointer to a Dish object in dishes_.
+ * @pre: The station is locked exclusively, or used by one thread.
+ * @post: A dish of a name the station did not carry yet has its recipe last in recipes_, indexed, screened by the
+filter, drawing on its stock slots and, if its ingredients are in stock, available.
+*/
+void KitchenStation::compileDish(Dish* dish) {
+    if (!recipe_index_.emplace(dish->getNameSymbol(), recipes_.size()).second) {
+        return;  // Earlier dishes keep their name
+    }
+    const std::size_t index = recipes_.size();
+    recipes_.push_back(compileRecipe(dish));
+    addToDishFilter(dish->getNameSymbol());
+    for (const RecipeStep& step : recipes_.back().steps) {
+        if (step.slot != NOT_STOCKED) {
+            slot_dependents_[step.slot].push_back({index, step.required_quantity});
+        }
+    }
+    if (available_bits_.size() * WORD_BITS < recipes_.size()) {
+        available_bits_.push_back(0);
+    }
+    if (recipes_.back().short_count == 0) {
+        recipes_.back().short_count = 1;  // Counted down to 0 so that the dish shows as available
+        changeShortCount(index, -1);
+    }
+}
+
+/**
+ * Compiles every recipe again, after an assigned dish's name or ingredients changed.
+ * @post: Orders go by the dishes' current names and ingredients, still to the first dish assigned under each name.
+The availability listener is told of each dish whose availability changed, and the menu listener of each name the
+station started or stopped carrying.
+*/
+void KitchenStation::recompileRecipes() {
+    std::function<void(const KitchenStation&, Symbol, bool)> menu_listener;
+    std::vector<Symbol> dropped;
+    std::vector<Symbol> added;
+    {
+        auto lock = writeLock();
+        if (concurrency_mode_ == LOCK_FREE) {
+            syncStock();  // So that the short counts tell which dishes were available
+        }
+        std::vector<Dish*> was_available;
+        for (const CompiledRecipe& recipe : recipes_) {
+            if (recipe.short_count == 0) {
+                was_available.push_back(recipe.dish);
+            }
+        }
+        std::unordered_map<Symbol, std::size_t> old_index;
+        old_index.swap(recipe_index_);
+        std::function<void(const KitchenStation&, Dish*, bool)> availability_listener;
+        availability_listener.swap(availability_listener_);  // Told of the net changes once all are compiled
+        recipes_.clear();
+        available_bits_.clear();
+        dish_filter_.clear();
+        for (std::vector<Dependent>& dependents : slot_dependents_) {
+            dependents.clear();
+        }
+        for (Dish* dish : dishes_) {
+            compileDish(dish);
+        }
+        availability_listener_.swap(availability_listener);
+
+        if (availability_listener_) {
+            for (Dish* dish : was_available) {
+                auto entry = recipe_index_.find(dish->getNameSymbol());
+                if (entry == recipe_index_.end() || recipes_[entry->second].dish != dish ||
+                    recipes_[entry->second].short_count > 0) {
+                    availability_listener_(*this, dish, false);
+                }
+            }
+            for (const CompiledRecipe& recipe : recipes_) {
+                if (recipe.short_count == 0 &&
+                    std::find(was_available.begin(), was_available.end(), recipe.dish) == was_available.end()) {
+                    availability_listener_(*this, recipe.dish, true);
+                }
+            }
+        }
+        for (const auto& entry : old_index) {
+            if (!recipe_index_.count(entry.first)) {
+                dropped.push_back(entry.first);
+            }
+        }
+        for (const auto& entry : recipe_index_) {
+            if (!old_index.count(entry.first)) {
+                added.push_back(entry.first);
+            }
+        }
+        menu_listener = menu_listener_;
+    }
+    // Told unlocked, as in assignDishToStation
+    if (menu_listener) {
+        for (Symbol dish_name : dropped) {
+            menu_listener(*this, dish_name, false);
+        }
+        for (Symbol dish_name : added) {
+            menu_listener(*this, dish_name, true);
+        }
+    }
+}
+
 /**
  * Replenishes the station's ingredient stock.
  * @param ingredient An Ingredient object.
  * @post: Adds the ingredient to the station's stock or updates the
-quantity if it already exists.
+quantity if it already exists, in constant time.
 */
 void KitchenStation::replenishStationIngredients(const Ingredient& ingredient) {
-    for (auto& stock_ingredient : ingredients_stock_) {
-        if (stock_ingredient.name == ingredient.name) {
-            stock_ingredient.quantity += ingredient.quantity;  // Update quantity if ingredient exists
-            return;
+    if (concurrency_mode_ == LOCK_FREE) {
+        auto lock = readLock();
+        auto slot = stock_slots_.find(ingredient.name);
+        if (slot != stock_slots_.end() && restockInPlace(slot->second, ingredient.quantity)) {
+            return;  // Only the counter changed
         }
     }
+    auto lock = writeLock();
+    if (concurrency_mode_ == LOCK_FREE) {
+        syncStock();
+    }
+    auto slot = stock_slots_.emplace(ingredient.name, ingredients_stock_.size());
+    const std::size_t index = slot.first->second;
+    if (!slot.second) {
+        if (int quantity = loadQuantity(index); quantity > 0) {
+            setStockQuantity(index, quantity + ingredient.quantity);  // Update quantity if ingredient exists
+        } else {
+            // The ingredient had run out: it is stocked anew in its old slot
+            ingredients_stock_[index] = ingredient;
+            setStockQuantity(index, ingredient.quantity);
+        }
+        return;
+    }
     // If ingredient does not exist, add it
     ingredients_stock_.push_back(ingredient);
+    addStockQuantity();
+    stock_next_.push_back(NOT_STOCKED);
+    stock_prev_.push_back(NOT_STOCKED);
+    slot_dependents_.emplace_back();
+
+    // Existing slots are unchanged, so only recipes still missing an ingredient can pick up the new one. They
+    // count it short until its quantity is set below.
+    for (std::size_t i = 0; i < recipes_.size(); i++) {
+        CompiledRecipe& recipe = recipes_[i];
+        for (std::size_t step = 0; recipe.missing > 0 && step < recipe.steps.size(); step++) {
+            if (recipe.steps[step].slot == NOT_STOCKED && recipe.ingredient_names[step] == ingredient.name) {
+                recipe.steps[step].slot = index;
+                recipe.missing--;
+                slot_dependents_[index].push_back({i, recipe.steps[step].required_quantity});
+            }
+        }
+    }
+    setStockQuantity(index, ingredient.quantity);
 }
 
 /**
  * Checks if the station can complete an order for a specific dish.
  * @param dish_name A string representing the name of the dish.
  * @return: True if the station has the dish assigned and all
-required ingredients are in stock; false otherwise.
+required ingredients are in stock; false otherwise. Constant time, availability is kept up to date as the stock
+changes.
 */
 bool KitchenStation::canCompleteOrder(const std::string& dish_name) const {
-    for (auto dish : dishes_) {
-        if (dish->getName() == dish_name) {
-            for (const auto& ingredient : dish->getIngredients()) {
-                bool found = false;
-                for (const auto& stock_ingredient : ingredients_stock_) {
-                    if (stock_ingredient.name == ingredient.name && stock_ingredient.quantity >= ingredient.required_quantity) {
-                        found = true;
-                        break;
-                    }
-                }
-                if (!found) {
-                    return false;  // Required ingredient not found
-                }
-            }
-            return true;  // All ingredients are in stock
-        }
+    Symbol dish;
+    return Symbol::find(dish_name, dish) && canCompleteOrder(dish);  // A name never interned is carried nowhere
+}
+
+/**
+ * Checks if the station can complete an order for a specific dish.
+ * @param dish_name The interned name of the dish.
+ * @return: True if the station has the dish assigned and all required ingredients are in stock; false otherwise.
+*/
+bool KitchenStation::canCompleteOrder(Symbol dish_name) const {
+    auto lock = readLock();
+    const CompiledRecipe* recipe = findRecipe(dish_name);
+    if (!recipe) {
+        return false;  // Not assigned to this station
     }
-    return false;  // Dish is not assigned to this station
+    if (concurrency_mode_ == LOCK_FREE) {
+        return findShortfall(*recipe) == recipe->steps.size();  // The short count lags behind the counters
+    }
+    return recipe->short_count == 0;
 }
 
 /**
@@ -143,37 +503,536 @@ used ingredients accordingly. If the stock ingredient is depleted to
  otherwise.
 */
 bool KitchenStation::prepareDish(const std::string& dish_name) {
-    // Check if station has the required dish and ingredients
-    if (!canCompleteOrder(dish_name)) {
+    return prepareDish(dish_name, 1);
+}
+
+/**
+ * Prepares a dish if possible, checking and deducting the stock in one pass over its compiled recipe.
+ * @param dish_name A string representing the name of the dish.
+ * @param count The number of servings to prepare, all or none. No servings (count < 1) are always possible and
+deduct nothing.
+ * @post: If the servings can be prepared, reduce the quantities of the used ingredients by count times the
+required quantities. An ingredient depleted to 0 is no longer in stock.
+ * @return: PREPARED if the servings were prepared; otherwise why not, and for INSUFFICIENT_STOCK the first
+ingredient that was short.
+*/
+KitchenStation::PrepareResult KitchenStation::tryPrepareDish(const std::string& dish_name, int count) {
+    Symbol dish;
+    if (!Symbol::find(dish_name, dish)) {
+        return {PrepareResult::NOT_ASSIGNED, ""};
+    }
+    return tryPrepareDish(dish, count);
+}
+
+/**
+ * Prepares a dish if possible, checking and deducting the stock in one pass over its compiled recipe.
+ * @param dish_name The interned name of the dish.
+ * @param count The number of servings to prepare, all or none.
+ * @post: As tryPrepareDish by string.
+ * @return: As tryPrepareDish by string.
+*/
+KitchenStation::PrepareResult KitchenStation::tryPrepareDish(Symbol dish_name, int count) {
+    std::shared_lock<std::shared_mutex> reader;
+    std::unique_lock<std::shared_mutex> writer;
+    lockForOrder(reader, writer);  // Held from the check to the deduction
+    const CompiledRecipe* recipe = findRecipe(dish_name);
+    if (!recipe) {
+        return {PrepareResult::NOT_ASSIGNED, ""};
+    }
+    if (count < 1) {
+        return {PrepareResult::PREPARED, ""};
+    }
+
+    std::size_t shortfall = prepareRecipe(*recipe, count);
+    if (shortfall < recipe->steps.size()) {
+        return {PrepareResult::INSUFFICIENT_STOCK, recipe->ingredient_names[shortfall].str()};
+    }
+    return {PrepareResult::PREPARED, ""};
+}
+
+/**
+ * Prepares several servings of a dish at once, if possible.
+ * @param dish_name A string representing the name of the dish.
+ * @param count The number of servings to prepare, all or none.
+ * @post: If all the servings can be prepared, reduce the quantities of the used ingredients by count times the
+required quantities.
+ * @return: True if the servings were prepared; false otherwise.
+*/
+bool KitchenStation::prepareDish(const std::string& dish_name, int count) {
+    Symbol dish;
+    if (!Symbol::find(dish_name, dish)) {
+        return false;
+    }
+    std::shared_lock<std::shared_mutex> reader;
+    std::unique_lock<std::shared_mutex> writer;
+    lockForOrder(reader, writer);  // Held from the check to the deduction
+    const CompiledRecipe* recipe = findRecipe(dish);
+    if (!recipe) {
         return false;
     }
+    return count < 1 || prepareRecipe(*recipe, count) == recipe->steps.size();  // Copies no ingredient name
+}
 
-    for (Dish* dish : dishes_) {
-        if (dish->getName() == dish_name) {
-            const auto& dish_ingredients = dish->getIngredients();
-
-            // For each dish ingredient, look for it in the station's ingredient stock
-            for (const auto& dish_ingredient : dish_ingredients) {
-                for (auto& stock_ingredient : ingredients_stock_) {
-                    if (dish_ingredient.name == stock_ingredient.name) {
-                        // Subtract the required quantity
-                        stock_ingredient.quantity -= dish_ingredient.required_quantity;
-                        if (stock_ingredient.quantity <= 0) {
-                            stock_ingredient.quantity = 0;
-                        }
-                        break;
-                    }
-                }
+/**
+ * Counts how many servings of a dish the stock allows.
+ * @param dish_name A string representing the name of the dish.
+ * @return: The minimum over the dish's ingredients of stock divided by required quantity; 0 if the dish is not
+assigned or an ingredient is not in stock. A dish that requires nothing is not limited:
+std::numeric_limits<int>::max().
+*/
+int KitchenStation::maxServings(const std::string& dish_name) const {
+    Symbol dish;
+    return Symbol::find(dish_name, dish) ? maxServings(dish) : 0;
+}
+
+/**
+ * Counts how many servings of a dish the stock allows.
+ * @param dish_name The interned name of the dish.
+ * @return: As maxServings by string.
+*/
+int KitchenStation::maxServings(Symbol dish_name) const {
+    auto lock = readLock();
+    const CompiledRecipe* recipe = findRecipe(dish_name);
+    if (!recipe || recipe->missing > 0) {
+        return 0;
+    }
+
+    int servings = std::numeric_limits<int>::max();
+    for (const RecipeStep& step : recipe->steps) {
+        int quantity = loadQuantity(step.slot);
+        if (quantity <= 0) {
+            return 0;  // Ran out
+        }
+        if (step.required_quantity > 0) {
+            servings = std::min(servings, quantity / step.required_quantity);
+        }
+    }
+    return servings;
+}
+
+/**
+ * Lists every dish the station can prepare right now.
+ * @return: The dishes whose ingredients are all in stock in the required quantity, in the order they were assigned
+(the first dish assigned under each name). Reads the availability kept up to date as the stock changes, in time
+proportional to the number of dishes returned.
+*/
+std::vector<Dish*> KitchenStation::getAvailableDishes() const {
+    auto lock = readLock();
+    std::vector<Dish*> available;
+    if (concurrency_mode_ == LOCK_FREE) {
+        for (const CompiledRecipe& recipe : recipes_) {  // The available bits lag behind the counters
+            if (findShortfall(recipe) == recipe.steps.size()) {
+                available.push_back(recipe.dish);
             }
         }
+        return available;
     }
+    for (std::size_t word = 0; word < available_bits_.size(); word++) {
+        for (std::uint64_t bits = available_bits_[word]; bits != 0; bits &= bits - 1) {
+            available.push_back(recipes_[word * WORD_BITS + __builtin_ctzll(bits)].dish);
+        }
+    }
+    return available;
+}
 
-    // Remove ingredients with 0 quantity
-    ingredients_stock_.erase(
-            std::remove_if(ingredients_stock_.begin(), ingredients_stock_.end(),
-                           [](const Ingredient& ingredient) { return ingredient.quantity == 0; }),
-            ingredients_stock_.end()
-    );
+/**
+ * @return: The size and hit counts of the filter screening dish names. false_positives / (rejected +
+false_positives) is its false positive rate on the dishes the station does not carry. The counts are approximate
+while several threads read the station.
+*/
+KitchenStation::DishFilterStats KitchenStation::getDishFilterStats() const {
+    auto lock = readLock();
+    return DishFilterStats{dish_filter_.size() * WORD_BITS, recipes_.size(), filter_lookups_, filter_rejected_,
+                           filter_false_positives_};
+}
 
+/**
+ * Looks a dish up among the compiled recipes.
+ * @param dish_name The interned name of the dish.
+ * @return: A pointer to its recipe; nullptr if no dish of that name is assigned.
+*/
+const KitchenStation::CompiledRecipe* KitchenStation::findRecipe(Symbol dish_name) const {
+    countFilterEvent(filter_lookups_);
+    if (!mayCarryDish(dish_name)) {
+        countFilterEvent(filter_rejected_);
+        return nullptr;
+    }
+    auto entry = recipe_index_.find(dish_name);
+    if (entry == recipe_index_.end()) {
+        countFilterEvent(filter_false_positives_);
+        return nullptr;
+    }
+    return &recipes_[entry->second];
+}
+
+/**
+ * Adds one to a filter counter without a read-modify-write, which readers sharing the lock may race on.
+ * @param counter The counter to bump.
+*/
+void KitchenStation::countFilterEvent(std::atomic<std::size_t>& counter) {
+    // A plain load and store: a locked increment on every lookup would cost more than the lookup
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+/**
+ * @return: A lock on the station shared with other readers, held only in LOCKED mode.
+*/
+std::shared_lock<std::shared_mutex> KitchenStation::readLock() const {
+    if (concurrency_mode_ == SINGLE_THREADED) {
+        return std::shared_lock<std::shared_mutex>();
+    }
+    return std::shared_lock<std::shared_mutex>(mutex_);
+}
+
+/**
+ * @return: A lock on the station excluding every other thread, held only in LOCKED mode.
+*/
+std::unique_lock<std::shared_mutex> KitchenStation::writeLock() const {
+    if (concurrency_mode_ == SINGLE_THREADED) {
+        return std::unique_lock<std::shared_mutex>();
+    }
+    return std::unique_lock<std::shared_mutex>(mutex_);
+}
+
+/**
+ * Locks the station for an order: exclusive in LOCKED mode, shared in LOCK_FREE mode, where the order reserves its
+stock itself.
+ * @param reader Set to the shared lock, if taken.
+ * @param writer Set to the exclusive lock, if taken.
+*/
+void KitchenStation::lockForOrder(std::shared_lock<std::shared_mutex>& reader,
+                                  std::unique_lock<std::shared_mutex>& writer) const {
+    if (concurrency_mode_ == LOCK_FREE) {
+        reader = readLock();
+    } else {
+        writer = writeLock();
+    }
+}
+
+/**
+ * Adds a dish name to the filter, rebuilding it larger when it holds too many names for its size.
+ * @param dish_name The name the station now takes orders for.
+ * @post: mayCarryDish(dish_name) is true.
+*/
+void KitchenStation::addToDishFilter(Symbol dish_name) {
+    if (dish_filter_.size() * WORD_BITS >= recipe_index_.size() * FILTER_BITS_PER_NAME) {
+        setFilterBits(filterHash(dish_name));
+        return;
+    }
+    std::size_t words = 1;
+    while (words * WORD_BITS < recipe_index_.size() * FILTER_BITS_PER_NAME) {
+        words *= 2;
+    }
+    dish_filter_.assign(words, 0);
+    for (const auto& entry : recipe_index_) {  // Already holds dish_name
+        setFilterBits(filterHash(entry.first));
+    }
+}
+
+/**
+ * @param dish_name The interned name of a dish.
+ * @return: Its ID spread over 64 bits, since consecutive IDs would otherwise pick neighbouring words and bits.
+*/
+std::uint64_t KitchenStation::filterHash(Symbol dish_name) {
+    std::uint64_t hash = dish_name.id() + std::uint64_t(0x9E3779B97F4A7C15);  // The splitmix64 finalizer
+    hash = (hash ^ (hash >> 30)) * std::uint64_t(0xBF58476D1CE4E5B9);
+    hash = (hash ^ (hash >> 27)) * std::uint64_t(0x94D049BB133111EB);
+    return hash ^ (hash >> 31);
+}
+
+/**
+ * Sets the bits of a dish name in the filter.
+ * @param hash filterHash of the name.
+*/
+void KitchenStation::setFilterBits(std::uint64_t hash) {
+    dish_filter_[(hash >> 32) & (dish_filter_.size() - 1)] |= filterMask(hash);
+}
+
+/**
+ * @param hash filterHash of a dish name.
+ * @return: The bits of the name within its word of the filter: one per probe, picked by successive 6-bit slices of
+the hash (the word is picked by its upper half).
+*/
+std::uint64_t KitchenStation::filterMask(std::uint64_t hash) {
+    std::uint64_t mask = 0;
+    for (std::size_t probe = 0; probe < FILTER_PROBES; probe++, hash >>= 6) {
+        mask |= std::uint64_t(1) << (hash % WORD_BITS);
+    }
+    return mask;
+}
+
+/**
+ * Screens a dish name against the filter.
+ * @param dish_name The interned name of the dish.
+ * @return: False if the station certainly does not carry the dish; true if it may.
+*/
+bool KitchenStation::mayCarryDish(Symbol dish_name) const {
+    if (dish_filter_.empty()) {
+        return false;  // No dish assigned
+    }
+    const std::uint64_t hash = filterHash(dish_name);
+    const std::uint64_t mask = filterMask(hash);
+    return (dish_filter_[(hash >> 32) & (dish_filter_.size() - 1)] & mask) == mask;  // One word holds all the probes
+}
+
+/**
+ * Sets the quantity of a stock slot.
+ * @param slot The slot of the ingredient.
+ * @param quantity The new quantity.
+ * @post: The short counts of the recipes drawing on the slot, and their availability, follow the quantity. A slot
+stocked from empty is linked last in stock order; one that ran out is unlinked.
+*/
+void KitchenStation::setStockQuantity(std::size_t slot, int quantity) {
+    const int previous = loadQuantity(slot);
+    stock_quantity_[slot].store(quantity, std::memory_order_relaxed);
+    if (previous <= 0 && quantity > 0) {
+        // Stocked from empty: listed last
+        stock_prev_[slot] = stock_tail_;
+        stock_next_[slot] = NOT_STOCKED;
+        (stock_tail_ == NOT_STOCKED ? stock_head_ : stock_next_[stock_tail_]) = slot;
+        stock_tail_ = slot;
+        in_stock_count_++;
+    } else if (previous > 0 && quantity <= 0) {
+        // Ran out: no longer listed
+        (stock_prev_[slot] == NOT_STOCKED ? stock_head_ : stock_next_[stock_prev_[slot]]) = stock_next_[slot];
+        (stock_next_[slot] == NOT_STOCKED ? stock_tail_ : stock_prev_[stock_next_[slot]]) = stock_prev_[slot];
+        stock_prev_[slot] = stock_next_[slot] = NOT_STOCKED;  // So that isLinked tells it apart
+        in_stock_count_--;
+    }
+    for (const Dependent& dependent : slot_dependents_[slot]) {
+        bool was_short = isShort(previous, dependent.required_quantity);
+        bool is_short = isShort(quantity, dependent.required_quantity);
+        if (was_short != is_short) {
+            changeShortCount(dependent.recipe, is_short ? 1 : -1);
+        }
+    }
+}
+
+/**
+ * Adjusts the short count of a recipe.
+ * @param recipe The index of the recipe in recipes_.
+ * @param delta +1 when a step becomes short, -1 when it is met again; the net change when syncStock recounts.
+ * @post: If the recipe became available or unavailable, its bit in available_bits_ follows and the availability
+listener is told.
+*/
+void KitchenStation::changeShortCount(std::size_t recipe, int delta) {
+    CompiledRecipe& compiled = recipes_[recipe];
+    const bool was_available = compiled.short_count == 0;
+    compiled.short_count += delta;
+    const bool available = compiled.short_count == 0;
+    if (was_available == available) {
+        return;
+    }
+    available_bits_[recipe / WORD_BITS] ^= std::uint64_t(1) << (recipe % WORD_BITS);
+    if (availability_listener_) {
+        availability_listener_(*this, compiled.dish, available);
+    }
+}
+
+/**
+ * @param quantity The stock of an ingredient.
+ * @param required_quantity The quantity a recipe step needs.
+ * @return: True if the step cannot be met: the ingredient ran out or there is not enough of it.
+*/
+bool KitchenStation::isShort(int quantity, int required_quantity) {
+    return quantity <= 0 || quantity < required_quantity;
+}
+
+/**
+ * Prepares servings of a compiled recipe, if the stock allows.
+ * @param recipe A recipe compiled for the current stock layout.
+ * @param count The number of servings to prepare, at least 1.
+ * @post: If the servings can be prepared, the stock is reduced by count times the required quantities.
+ * @return: The index of the first step that was short; recipe.steps.size() if the servings were prepared.
+*/
+std::size_t KitchenStation::prepareRecipe(const CompiledRecipe& recipe, int count) {
+    if (concurrency_mode_ == LOCK_FREE) {
+        return reserveRecipe(recipe, count);
+    }
+    if (count > 1 || recipe.short_count > 0) {  // One serving of an available dish needs no check
+        std::size_t shortfall = findShortfall(recipe, count);
+        if (shortfall < recipe.steps.size()) {
+            return shortfall;
+        }
+    }
+    for (const RecipeStep& step : recipe.steps) {
+        // Subtract the required quantity; a depleted ingredient keeps its slot, so no recipe needs recompiling
+        int quantity = loadQuantity(step.slot) - step.required_quantity * count;  // Bounded by findShortfall
+        setStockQuantity(step.slot, quantity < 0 ? 0 : quantity);
+    }
+    return recipe.steps.size();
+}
+
+/**
+ * Prepares servings of a compiled recipe in LOCK_FREE mode, reserving each ingredient with compare-and-swap.
+ * @param recipe A recipe compiled for the current stock layout.
+ * @param count The number of servings to prepare, at least 1.
+ * @post: If every ingredient could be reserved, the stock is reduced by count times the required quantities;
+otherwise the ingredients reserved so far are given back.
+ * @return: The index of the first step that was short; recipe.steps.size() if the servings were prepared.
+*/
+std::size_t KitchenStation::reserveRecipe(const CompiledRecipe& recipe, int count) {
+    std::size_t reserved = 0;
+    for (; reserved < recipe.steps.size(); reserved++) {
+        const RecipeStep& step = recipe.steps[reserved];
+        if (step.slot == NOT_STOCKED) {
+            break;
+        }
+        const long long needed = static_cast<long long>(step.required_quantity) * count;
+        std::atomic<int>& counter = stock_quantity_[step.slot];
+        int quantity = counter.load(std::memory_order_relaxed);
+        bool short_step = false;
+        do {
+            short_step = quantity <= 0 || quantity < needed;
+        } while (!short_step && !counter.compare_exchange_weak(quantity, static_cast<int>(quantity - needed),
+                                                               std::memory_order_acq_rel, std::memory_order_relaxed));
+        if (short_step) {
+            break;
+        }
+    }
+    if (reserved == recipe.steps.size()) {
+        return reserved;
+    }
+    for (std::size_t i = 0; i < reserved; i++) {  // Give back what was taken, in any order
+        const RecipeStep& step = recipe.steps[i];
+        stock_quantity_[step.slot].fetch_add(step.required_quantity * count, std::memory_order_release);
+    }
+    return reserved;
+}
+
+/**
+ * Adds to the quantity of an ingredient still in stock, in LOCK_FREE mode.
+ * @param slot The slot of the ingredient.
+ * @param quantity The quantity to add.
+ * @return: True if it was added; false if the ingredient ran out, so that it must be stocked anew under the exclusive
+lock.
+*/
+bool KitchenStation::restockInPlace(std::size_t slot, int quantity) {
+    std::atomic<int>& counter = stock_quantity_[slot];
+    int current = counter.load(std::memory_order_relaxed);
+    do {
+        if (current <= 0) {
+            return false;
+        }
+    } while (!counter.compare_exchange_weak(current, current + quantity, std::memory_order_acq_rel,
+                                            std::memory_order_relaxed));
     return true;
 }
+
+/**
+ * Brings what LOCK_FREE mode leaves behind up to date with the counters: the short counts, the available dishes
+(telling the availability listener) and the stock order, where ingredients restocked from empty are listed last, in
+slot order.
+ * @pre: The station is locked exclusively, or used by one thread.
+*/
+void KitchenStation::syncStock() {
+    std::vector<std::size_t> order;  // Slots in stock, in their new stock order
+    for (std::size_t slot = stock_head_; slot != NOT_STOCKED; slot = stock_next_[slot]) {
+        if (loadQuantity(slot) > 0) {
+            order.push_back(slot);
+        }
+    }
+    for (std::size_t slot = 0; slot < ingredients_stock_.size(); slot++) {
+        if (loadQuantity(slot) > 0 && !isLinked(slot)) {
+            order.push_back(slot);
+        }
+    }
+    std::fill(stock_next_.begin(), stock_next_.end(), NOT_STOCKED);
+    std::fill(stock_prev_.begin(), stock_prev_.end(), NOT_STOCKED);
+    stock_head_ = stock_tail_ = NOT_STOCKED;
+    for (std::size_t slot : order) {
+        stock_prev_[slot] = stock_tail_;
+        (stock_tail_ == NOT_STOCKED ? stock_head_ : stock_next_[stock_tail_]) = slot;
+        stock_tail_ = slot;
+    }
+    in_stock_count_ = order.size();
+
+    for (std::size_t i = 0; i < recipes_.size(); i++) {
+        CompiledRecipe& recipe = recipes_[i];
+        std::size_t short_count = recipe.missing;
+        for (const RecipeStep& step : recipe.steps) {
+            short_count += step.slot != NOT_STOCKED && isShort(loadQuantity(step.slot), step.required_quantity);
+        }
+        if (short_count != recipe.short_count) {
+            changeShortCount(i, static_cast<int>(short_count) - static_cast<int>(recipe.short_count));
+        }
+    }
+}
+
+/**
+ * @param slot The slot of an ingredient.
+ * @return: Its quantity, read atomically since LOCK_FREE orders may be changing it.
+*/
+int KitchenStation::loadQuantity(std::size_t slot) const {
+    return stock_quantity_[slot].load(std::memory_order_relaxed);
+}
+
+/**
+ * Gives a new ingredient a stock quantity of 0, in the slot after the last one.
+ * @pre: The station is locked exclusively, or used by one thread.
+ * @post: The quantities may have moved to a larger array.
+*/
+void KitchenStation::addStockQuantity() {
+    const std::size_t slot = ingredients_stock_.size() - 1;  // The new ingredient is already stocked
+    if (slot == stock_capacity_) {
+        const std::size_t capacity = stock_capacity_ == 0 ? 8 : stock_capacity_ * 2;
+        std::unique_ptr<std::atomic<int>[]> quantities(new std::atomic<int>[capacity]);
+        for (std::size_t i = 0; i < slot; i++) {
+            quantities[i].store(loadQuantity(i), std::memory_order_relaxed);
+        }
+        stock_quantity_ = std::move(quantities);
+        stock_capacity_ = capacity;
+    }
+    stock_quantity_[slot].store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @param slot The slot of an ingredient.
+ * @return: True if the slot is linked in stock order.
+*/
+bool KitchenStation::isLinked(std::size_t slot) const {
+    return slot == stock_head_ || stock_prev_[slot] != NOT_STOCKED;
+}
+
+/**
+ * Resolves the ingredients of a dish against the stock.
+ * @param dish A pointer to a Dish object.
+ * @return: The recipe of the dish for the current stock layout, with its short count.
+*/
+KitchenStation::CompiledRecipe KitchenStation::compileRecipe(Dish* dish) const {
+    CompiledRecipe recipe{dish, {}, {}, 0, 0};
+    for (const Ingredient& ingredient : dish->viewIngredients()) {
+        auto slot = stock_slots_.find(ingredient.name);
+        if (slot != stock_slots_.end()) {
+            recipe.steps.push_back({slot->second, ingredient.required_quantity});
+            recipe.short_count += isShort(loadQuantity(slot->second), ingredient.required_quantity);
+        } else {
+            recipe.steps.push_back({NOT_STOCKED, ingredient.required_quantity});
+            recipe.missing++;
+            recipe.short_count++;
+        }
+        recipe.ingredient_names.push_back(ingredient.name);
+    }
+    return recipe;
+}
+
+/**
+ * Checks a compiled recipe against the stock.
+ * @param recipe A recipe compiled for the current stock layout.
+ * @param count The number of servings to check for, at least 1.
+ * @return: The index of the first step whose ingredient is not in stock in count times the required quantity;
+recipe.steps.size() if there is none.
+*/
+std::size_t KitchenStation::findShortfall(const CompiledRecipe& recipe, int count) const {
+    for (std::size_t i = 0; i < recipe.steps.size(); i++) {
+        const RecipeStep& step = recipe.steps[i];
+        if (step.slot == NOT_STOCKED) {
+            return i;  // Required ingredient not found
+        }
+        int quantity = loadQuantity(step.slot);
+        if (quantity <= 0 || quantity < static_cast<long long>(step.required_quantity) * count) {
+            return i;  // Ran out, or not enough of it
+        }
+    }
+    return recipe.steps.size();  // All ingredients are in stock
+}
@@ -11,12 +11,110 @@
 #ifndef KITCHEN_STATION_HPP
 #define KITCHEN_STATION_HPP
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "Dish.hpp"
+#include "Symbol.hpp"
 
 class KitchenStation {
 public:
+    /**
+    * How the station synchronizes the threads that use it.
+    * - SINGLE_THREADED: No synchronization; one thread at a time.
+    * - LOCKED: Each call takes the station's lock. Calls that only read
+    the station (canCompleteOrder, maxServings and the getters) share
+    it, so they do not block each other; calls that change the station
+    hold it alone, so an order is checked and deducted in one step.
+    * - LOCK_FREE: Each ingredient quantity is an atomic counter. An
+    order reserves its ingredients one by one with compare-and-swap and
+    gives them back if one is short, so it never oversells and never
+    waits for another order; an order may fail on stock that a
+    concurrent order is about to give back. Orders, reads and restocks
+    of ingredients in stock share the station's lock, which only keeps
+    out changes to the station's layout (assigning a dish, stocking a
+    new or depleted ingredient); those hold it alone. Availability is
+    read from the counters instead of being kept up to date, so the
+    availability listener and the stock order catch up only when the
+    layout changes or the mode is left.
+    */
+    enum ConcurrencyMode { SINGLE_THREADED, LOCKED, LOCK_FREE };
+
+    /**
+    * The outcome of an attempt to prepare a dish.
+    * - PREPARED: The dish was prepared and the stock deducted.
+    * - NOT_ASSIGNED: No dish of that name is assigned to the station.
+    * - INSUFFICIENT_STOCK: An ingredient is missing or short; the stock
+    is unchanged.
+    */
+    struct PrepareResult {
+        enum Status { PREPARED, NOT_ASSIGNED, INSUFFICIENT_STOCK };
+
+        Status status;
+        std::string short_ingredient; // The first ingredient found short, in dish order; empty unless INSUFFICIENT_STOCK
+    };
+
+    /**
+    * Usage of the Bloom filter that screens dish names before the
+    station looks them up.
+    */
+    struct DishFilterStats {
+        std::size_t bits; // Size of the filter
+        std::size_t names; // Dish names in the filter
+        std::size_t lookups; // Dish names screened
+        std::size_t rejected; // Lookups the filter answered alone: the station does not carry the dish
+        std::size_t false_positives; // Lookups the filter let through for a dish the station does not carry
+    };
+
+    /**
+    * A read-only range over the ingredients in stock, in the order they
+    were stocked, that copies nothing up front. Each element is built on
+    access with the current quantity; building it does not allocate.
+    The view is invalidated when the station's stock changes.
+    */
+    class StockView {
+    public:
+        class const_iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = Ingredient;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const Ingredient*;
+            using reference = Ingredient;
+
+            Ingredient operator*() const;
+            const_iterator& operator++();
+            const_iterator operator++(int);
+            bool operator==(const const_iterator& rhs) const { return slot_ == rhs.slot_; }
+            bool operator!=(const const_iterator& rhs) const { return slot_ != rhs.slot_; }
+
+        private:
+            friend class StockView;
+            const_iterator(const KitchenStation* station, std::size_t slot) : station_(station), slot_(slot) {}
+
+            const KitchenStation* station_;
+            std::size_t slot_;
+        };
+
+        const_iterator begin() const;
+        const_iterator end() const;
+        std::size_t size() const;
+        bool empty() const { return size() == 0; }
+
+    private:
+        friend class KitchenStation;
+        explicit StockView(const KitchenStation* station) : station_(station) {}
+
+        const KitchenStation* station_;
+    };
 
     /**
     * Default Constructor
@@ -43,12 +141,41 @@ public:
     */
     std::string getName() const;
 
+    /**
+    * @return: The name of the station as an interned symbol, for
+    comparing and hashing.
+    */
+    Symbol getNameSymbol() const;
+
     /**
     * Sets the name of the kitchen station.
     * @param name A string representing the new station name.
-    * @post: Updates the station's name.
+    * @post: Updates the station's name, unless the rename listener
+    vetoes it.
+    * @return: True if the name was updated; false otherwise.
     */
-    void setName(const std::string& name);
+    bool setName(const std::string& name);
+
+    /**
+    * Registers the callback consulted before the station is renamed.
+    * @param listener Called with the station (still under its old name)
+    and the requested name; returning false vetoes the rename. An empty
+    function removes the listener.
+    * @post: Replaces any previously registered listener.
+    */
+    void setRenameListener(std::function<bool(const KitchenStation&, const std::string&)> listener);
+
+    /**
+    * Registers the callback told when the station starts or stops
+    taking orders for a dish name.
+    * @param listener Called with the station, the name and whether the
+    station now carries it: once the first dish of that name is
+    assigned, and when a dish is renamed or changed. It is called with
+    the station unlocked, so it may take the lock of the station's
+    manager. An empty function removes the listener.
+    * @post: Replaces any previously registered listener.
+    */
+    void setMenuListener(std::function<void(const KitchenStation&, Symbol, bool)> listener);
 
     /**
     * Retrieves the list of dishes assigned to the kitchen station.
@@ -56,18 +183,62 @@ public:
     */
     std::vector<Dish*> getDishes() const;
 
+    /**
+    * Views the dishes assigned to the kitchen station without copying
+    them.
+    * @return A reference to the station's list of dishes, valid until
+    a dish is assigned or the station is destroyed.
+    */
+    const std::vector<Dish*>& viewDishes() const;
+
+    /**
+    * Retrieves the names the station takes orders for.
+    * @return The name of each dish as it was when first assigned under
+    it, in the order they were assigned.
+    */
+    std::vector<Symbol> getDishNames() const;
+
     /**
     * Retrieves the ingredient stock available at the kitchen station.
     * @return A vector of Ingredient objects representing the station's
-    ingredient stock.
+    ingredient stock, in the order the ingredients were stocked.
+    Ingredients that ran out are not listed; restocking one lists it
+    last.
     */
     std::vector<Ingredient> getIngredientsStock() const;
 
+    /**
+    * Views the ingredient stock available at the kitchen station
+    without copying it.
+    * @return A range over the same ingredients as getIngredientsStock,
+    in the same order, valid until the stock changes.
+    */
+    StockView viewIngredientsStock() const;
+
+    /**
+    * Sets how the station synchronizes the threads that use it.
+    * @param mode The new ConcurrencyMode (SINGLE_THREADED by default).
+    * @pre: No other thread is using the station.
+    * @post: Later calls synchronize according to the mode. The views
+    (viewDishes, viewIngredientsStock) are never synchronized: read them
+    only while no other thread changes the station, and not in LOCK_FREE
+    mode, whose stock order lags behind the counters.
+    */
+    void setConcurrencyMode(ConcurrencyMode mode);
+
+    /**
+    * @return: How the station synchronizes the threads that use it.
+    */
+    ConcurrencyMode getConcurrencyMode() const;
+
     /**
     * Assigns a dish to the station.
     * @param dish A pointer to a Dish object.
     * @post: Adds the dish to the station's list of dishes if not
-    already present.
+    already present, and compiles its recipe against the stock. Changing
+    the dish's name or ingredients later has the station compile it
+    again. Orders for a name go to the first dish assigned under it. The
+    menu listener is told of a name the station did not carry yet.
     * @return: True if the dish was added successfully; false
     otherwise.
     */
@@ -77,18 +248,39 @@ public:
     * Replenishes the station's ingredient stock.
     * @param ingredient An Ingredient object.
     * @post: Adds the ingredient to the station's stock or updates the
-    quantity if it already exists.
+    quantity if it already exists, in constant time.
     */
     void replenishStationIngredients(const Ingredient& ingredient);
 
+    /**
+    * Registers the callback told when a dish becomes available or
+    unavailable.
+    * @param listener Called with the station, the dish and whether it
+    is now available, each time a dish joins or leaves the available
+    dishes (including when it is assigned already available). It must
+    not modify the station, and in LOCKED mode it is called with the
+    station locked, so it must not call the station at all. An empty
+    function removes the listener.
+    * @post: Replaces any previously registered listener.
+    */
+    void setAvailabilityListener(std::function<void(const KitchenStation&, Dish*, bool)> listener);
+
     /**
     * Checks if the station can complete an order for a specific dish.
     * @param dish_name A string representing the name of the dish.
     * @return: True if the station has the dish assigned and all
-    required ingredients are in stock; false otherwise.
+    required ingredients are in stock; false otherwise. Constant time,
+    availability is kept up to date as the stock changes.
     */
     bool canCompleteOrder(const std::string& dish_name) const;
 
+    /**
+    * Checks if the station can complete an order for a specific dish.
+    * @param dish_name The interned name of the dish.
+    * @return: As canCompleteOrder by string, without hashing the name.
+    */
+    bool canCompleteOrder(Symbol dish_name) const;
+
     /**
     * Prepares a dish if possible.
     * @param dish_name A string representing the name of the dish.
@@ -100,10 +292,351 @@ public:
     */
     bool prepareDish(const std::string& dish_name);
 
+    /**
+    * Prepares a dish if possible, checking and deducting the stock in
+    one pass over its compiled recipe.
+    * @param dish_name A string representing the name of the dish.
+    * @param count The number of servings to prepare, all or none. No
+    servings (count < 1) are always possible and deduct nothing.
+    * @post: If the servings can be prepared, reduce the quantities of
+    the used ingredients by count times the required quantities. An
+    ingredient depleted to 0 is no longer in stock.
+    * @return: PREPARED if the servings were prepared; otherwise why
+    not, and for INSUFFICIENT_STOCK the first ingredient that was short.
+    */
+    PrepareResult tryPrepareDish(const std::string& dish_name, int count = 1);
+
+    /**
+    * Prepares a dish if possible.
+    * @param dish_name The interned name of the dish.
+    * @param count The number of servings to prepare, all or none.
+    * @post: As tryPrepareDish by string.
+    * @return: As tryPrepareDish by string, without hashing the name.
+    */
+    PrepareResult tryPrepareDish(Symbol dish_name, int count = 1);
+
+    /**
+    * Prepares several servings of a dish at once, if possible.
+    * @param dish_name A string representing the name of the dish.
+    * @param count The number of servings to prepare, all or none.
+    * @post: If all the servings can be prepared, reduce the quantities
+    of the used ingredients by count times the required quantities.
+    * @return: True if the servings were prepared; false otherwise.
+    */
+    bool prepareDish(const std::string& dish_name, int count);
+
+    /**
+    * Counts how many servings of a dish the stock allows.
+    * @param dish_name A string representing the name of the dish.
+    * @return: The minimum over the dish's ingredients of stock divided
+    by required quantity; 0 if the dish is not assigned or an
+    ingredient is not in stock. A dish that requires nothing is not
+    limited: std::numeric_limits<int>::max().
+    */
+    int maxServings(const std::string& dish_name) const;
+
+    /**
+    * Counts how many servings of a dish the stock allows.
+    * @param dish_name The interned name of the dish.
+    * @return: As maxServings by string, without hashing the name.
+    */
+    int maxServings(Symbol dish_name) const;
+
+    /**
+    * Lists every dish the station can prepare right now.
+    * @return: The dishes whose ingredients are all in stock in the
+    required quantity, in the order they were assigned (the first dish
+    assigned under each name). Reads the availability kept up to date
+    as the stock changes, in time proportional to the number of dishes
+    returned.
+    */
+    std::vector<Dish*> getAvailableDishes() const;
+
+    /**
+    * @return: The size and hit counts of the filter screening dish
+    names. false_positives / (rejected + false_positives) is its false
+    positive rate on the dishes the station does not carry. The counts
+    are approximate while several threads read the station.
+    */
+    DishFilterStats getDishFilterStats() const;
+
 private:
-    std::string station_name_; //Represents the name of the station
+    friend class Dish; // Has the station compile it again when it changes
+
+    Symbol station_name_; //Represents the name of the station
+    std::function<bool(const KitchenStation&, const std::string&)> rename_listener_; // Consulted by setName
+    std::function<void(const KitchenStation&, Symbol, bool)> menu_listener_; // Told of dish names carried or dropped
+    std::function<void(const KitchenStation&, Dish*, bool)> availability_listener_; // Told of availability flips
     std::vector<Dish*> dishes_; // Dishes the station can prepare
-    std::vector<Ingredient> ingredients_stock_; // Available ingredients
+    // Every ingredient ever stocked keeps its slot; one that ran out stays behind with quantity 0
+    std::vector<Ingredient> ingredients_stock_; // Ingredients by slot; their quantity is kept in stock_quantity_
+    // Quantity by slot, packed for the feasibility loops; atomic since LOCK_FREE orders change it concurrently
+    std::unique_ptr<std::atomic<int>[]> stock_quantity_;
+    std::size_t stock_capacity_; // Slots stock_quantity_ has room for
+    // The slots in stock, linked in the order they were last stocked from empty; NOT_STOCKED ends the links
+    std::vector<std::size_t> stock_next_;
+    std::vector<std::size_t> stock_prev_;
+    std::size_t stock_head_;
+    std::size_t stock_tail_;
+    std::size_t in_stock_count_;
+    std::unordered_map<Symbol, std::size_t> stock_slots_; // Ingredient name -> slot
+
+    /**
+    * One ingredient of a compiled recipe.
+    */
+    struct RecipeStep {
+        std::size_t slot; // Index of the ingredient in ingredients_stock_
+        int required_quantity;
+    };
+
+    /**
+    * A dish resolved against the stock, so that orders need no name lookups.
+    */
+    struct CompiledRecipe {
+        Dish* dish;
+        std::vector<RecipeStep> steps; // One per ingredient, in dish order; slot NOT_STOCKED if it has none
+        std::vector<Symbol> ingredient_names; // Parallel to steps
+        std::size_t missing; // Number of ingredients without a slot
+        std::size_t short_count; // Number of steps whose ingredient is not in stock in the required quantity
+    };
+
+    /**
+    * A recipe step drawing on a stock slot, to be re-checked when the
+    slot's quantity changes.
+    */
+    struct Dependent {
+        std::size_t recipe; // Index in recipes_
+        int required_quantity;
+    };
+
+    static constexpr std::size_t NOT_STOCKED = static_cast<std::size_t>(-1);
+    static constexpr std::size_t WORD_BITS = 64; // Recipes per word of available_bits_
+
+    std::vector<CompiledRecipe> recipes_; // Recipe of the first dish assigned under each name, in assignment order
+    std::unordered_map<Symbol, std::size_t> recipe_index_; // Dish name -> index in recipes_
+    std::vector<std::vector<Dependent>> slot_dependents_; // Slot -> the recipe steps that draw on it
+    std::vector<std::uint64_t> available_bits_; // One bit per recipe, set while its short_count is 0
+
+    // Bloom filter over the keys of recipe_index_, so that most names the station does not carry skip the lookup
+    std::vector<std::uint64_t> dish_filter_; // A power of two of words; empty while no dish is assigned
+    // Bumped by readers sharing the lock, so atomic; a count lost to a race only skews the stats
+    mutable std::atomic<std::size_t> filter_lookups_;
+    mutable std::atomic<std::size_t> filter_rejected_;
+    mutable std::atomic<std::size_t> filter_false_positives_;
+    static constexpr std::size_t FILTER_BITS_PER_NAME = 10; // At least; about 1% false positives with 5 probes
+    static constexpr std::size_t FILTER_PROBES = 5; // Bits set per name, all in one word of the filter
+
+    ConcurrencyMode concurrency_mode_;
+    mutable std::shared_mutex mutex_; // Taken only in LOCKED mode
+
+    /**
+    * @return: A lock on the station shared with other readers, held
+    only in LOCKED mode.
+    */
+    std::shared_lock<std::shared_mutex> readLock() const;
+
+    /**
+    * @return: A lock on the station excluding every other thread, held
+    only in LOCKED mode.
+    */
+    std::unique_lock<std::shared_mutex> writeLock() const;
+
+    /**
+    * Locks the station for an order: exclusive in LOCKED mode, shared
+    in LOCK_FREE mode, where the order reserves its stock itself.
+    * @param reader Set to the shared lock, if taken.
+    * @param writer Set to the exclusive lock, if taken.
+    */
+    void lockForOrder(std::shared_lock<std::shared_mutex>& reader, std::unique_lock<std::shared_mutex>& writer) const;
+
+    /**
+    * Adds one to a filter counter without a read-modify-write, which
+    readers sharing the lock may race on.
+    * @param counter The counter to bump.
+    */
+    static void countFilterEvent(std::atomic<std::size_t>& counter);
+
+    /**
+    * Adds a dish to the station and compiles its recipe.
+    * @param dish A pointer to a Dish object.
+    * @pre: The station is locked exclusively, or used by one thread.
+    * @post: As assignDishToStation, without telling the menu listener.
+    * @return: True if the dish was added; false if it was already
+    assigned.
+    */
+    bool addDish(Dish* dish);
+
+    /**
+    * Compiles the recipe of an assigned dish, unless an earlier dish
+    has its name.
+    * @param dish A pointer to a Dish object in dishes_.
+    * @pre: The station is locked exclusively, or used by one thread.
+    * @post: A dish of a name the station did not carry yet has its
+    recipe last in recipes_, indexed, screened by the filter, drawing on
+    its stock slots and, if its ingredients are in stock, available.
+    */
+    void compileDish(Dish* dish);
+
+    /**
+    * Compiles every recipe again, after an assigned dish's name or
+    ingredients changed.
+    * @post: Orders go by the dishes' current names and ingredients,
+    still to the first dish assigned under each name. The availability
+    listener is told of each dish whose availability changed, and the
+    menu listener of each name the station started or stopped carrying.
+    */
+    void recompileRecipes();
+
+    /**
+    * Looks a dish up among the compiled recipes.
+    * @param dish_name The interned name of the dish.
+    * @return: A pointer to its recipe; nullptr if no dish of that name
+    is assigned.
+    */
+    const CompiledRecipe* findRecipe(Symbol dish_name) const;
+
+    /**
+    * Adds a dish name to the filter, rebuilding it larger when it holds
+    too many names for its size.
+    * @param dish_name The name the station now takes orders for.
+    * @post: mayCarryDish(dish_name) is true.
+    */
+    void addToDishFilter(Symbol dish_name);
+
+    /**
+    * @param dish_name The interned name of a dish.
+    * @return: Its ID spread over 64 bits.
+    */
+    static std::uint64_t filterHash(Symbol dish_name);
+
+    /**
+    * Sets the bits of a dish name in the filter.
+    * @param hash filterHash of the name.
+    */
+    void setFilterBits(std::uint64_t hash);
+
+    /**
+    * @param hash filterHash of a dish name.
+    * @return: The bits of the name within its word of the filter.
+    */
+    static std::uint64_t filterMask(std::uint64_t hash);
+
+    /**
+    * Screens a dish name against the filter.
+    * @param dish_name The interned name of the dish.
+    * @return: False if the station certainly does not carry the dish;
+    true if it may.
+    */
+    bool mayCarryDish(Symbol dish_name) const;
+
+    /**
+    * Sets the quantity of a stock slot.
+    * @param slot The slot of the ingredient.
+    * @param quantity The new quantity.
+    * @post: The short counts of the recipes drawing on the slot, and
+    their availability, follow the quantity. A slot stocked from empty
+    is linked last in stock order; one that ran out is unlinked.
+    */
+    void setStockQuantity(std::size_t slot, int quantity);
+
+    /**
+    * Prepares servings of a compiled recipe, if the stock allows.
+    * @param recipe A recipe compiled for the current stock layout.
+    * @param count The number of servings to prepare, at least 1.
+    * @post: If the servings can be prepared, the stock is reduced by
+    count times the required quantities.
+    * @return: The index of the first step that was short;
+    recipe.steps.size() if the servings were prepared.
+    */
+    std::size_t prepareRecipe(const CompiledRecipe& recipe, int count);
+
+    /**
+    * Prepares servings of a compiled recipe in LOCK_FREE mode, reserving
+    each ingredient with compare-and-swap.
+    * @param recipe A recipe compiled for the current stock layout.
+    * @param count The number of servings to prepare, at least 1.
+    * @post: If every ingredient could be reserved, the stock is reduced
+    by count times the required quantities; otherwise the ingredients
+    reserved so far are given back.
+    * @return: As prepareRecipe.
+    */
+    std::size_t reserveRecipe(const CompiledRecipe& recipe, int count);
+
+    /**
+    * Adds to the quantity of an ingredient still in stock, in LOCK_FREE
+    mode.
+    * @param slot The slot of the ingredient.
+    * @param quantity The quantity to add.
+    * @return: True if it was added; false if the ingredient ran out, so
+    that it must be stocked anew under the exclusive lock.
+    */
+    bool restockInPlace(std::size_t slot, int quantity);
+
+    /**
+    * Brings what LOCK_FREE mode leaves behind up to date with the
+    counters: the short counts, the available dishes (telling the
+    availability listener) and the stock order, where ingredients
+    restocked from empty are listed last, in slot order.
+    * @pre: The station is locked exclusively, or used by one thread.
+    */
+    void syncStock();
+
+    /**
+    * @param slot The slot of an ingredient.
+    * @return: Its quantity, read atomically since LOCK_FREE orders may
+    be changing it.
+    */
+    int loadQuantity(std::size_t slot) const;
+
+    /**
+    * Gives a new ingredient a stock quantity of 0, in the slot after the
+    last one.
+    * @pre: The station is locked exclusively, or used by one thread.
+    * @post: The quantities may have moved to a larger array.
+    */
+    void addStockQuantity();
+
+    /**
+    * @param slot The slot of an ingredient.
+    * @return: True if the slot is linked in stock order.
+    */
+    bool isLinked(std::size_t slot) const;
+
+    /**
+    * Adjusts the short count of a recipe.
+    * @param recipe The index of the recipe in recipes_.
+    * @param delta +1 when a step becomes short, -1 when it is met again;
+    the net change when syncStock recounts.
+    * @post: If the recipe became available or unavailable, its bit in
+    available_bits_ follows and the availability listener is told.
+    */
+    void changeShortCount(std::size_t recipe, int delta);
+
+    /**
+    * @param quantity The stock of an ingredient.
+    * @param required_quantity The quantity a recipe step needs.
+    * @return: True if the step cannot be met: the ingredient ran out or
+    there is not enough of it.
+    */
+    static bool isShort(int quantity, int required_quantity);
+
+    /**
+    * Resolves the ingredients of a dish against the stock.
+    * @param dish A pointer to a Dish object.
+    * @return: The recipe of the dish for the current stock layout, with
+    its short count.
+    */
+    CompiledRecipe compileRecipe(Dish* dish) const;
+
+    /**
+    * Checks a compiled recipe against the stock.
+    * @param recipe A recipe compiled for the current stock layout.
+    * @param count The number of servings to check for, at least 1.
+    * @return: The index of the first step whose ingredient is not in
+    stock in count times the required quantity; recipe.steps.size() if
+    there is none.
+    */
+    std::size_t findShortfall(const CompiledRecipe& recipe, int count = 1) const;
 };
 
-#endif // KITCHEN_STATION_HPP
\ No newline at end of file
+#endif // KITCHEN_STATION_HPP
@@ -12,28 +12,32 @@
  @file LinkedList.cpp */
 
 #include "LinkedList.hpp"  // Header file
+#include <algorithm>
 #include <cassert>
+#include <utility>
 
 // constructor
-template<class T>
-LinkedList<T>::LinkedList() : head_ptr_(nullptr), item_count_(0)
+template<class T, class Allocator>
+LinkedList<T, Allocator>::LinkedList() : head_ptr_(nullptr), tail_ptr_(nullptr), item_count_(0)
 {
 }  // end default constructor
 
 
 // copy constructor
-template<class T>
-LinkedList<T>::LinkedList(const LinkedList<T>& a_list) : item_count_(a_list.item_count_)
+template<class T, class Allocator>
+LinkedList<T, Allocator>::LinkedList(const LinkedList<T, Allocator>& a_list) : item_count_(a_list.item_count_)
 {
    Node<T>* orig_chain_pointer = a_list.head_ptr_;  // Points to nodes in original chain
 
    if (orig_chain_pointer == nullptr)
+   {
       head_ptr_ = nullptr;  // Original list is empty
+      tail_ptr_ = nullptr;
+   }
    else
    {
       // Copy first node
-      head_ptr_ = new Node<T>();
-      head_ptr_->setItem(orig_chain_pointer->getItem());
+      head_ptr_ = allocator_.create(orig_chain_pointer->getItem());
 
       // Copy remaining nodes
       Node<T>* new_chain_ptr = head_ptr_;      // Points to last node in new chain
@@ -41,10 +45,10 @@ LinkedList<T>::LinkedList(const LinkedList<T>& a_list) : item_count_(a_list.item
       while (orig_chain_pointer != nullptr)
       {
          // Get next item from original chain
-         T next_item = orig_chain_pointer->getItem();
+         const T& next_item = orig_chain_pointer->getItem();
 
          // Create a new node containing the next item
-         Node<T>* new_node_ptr = new Node<T>(next_item);
+         Node<T>* new_node_ptr = allocator_.create(next_item);
 
          // Link new node to end of new chain
          new_chain_ptr->setNext(new_node_ptr);
@@ -57,13 +61,51 @@ LinkedList<T>::LinkedList(const LinkedList<T>& a_list) : item_count_(a_list.item
       }  // end while
 
       new_chain_ptr->setNext(nullptr);              // Flag end of chain
+      tail_ptr_ = new_chain_ptr;
    }  // end if
 }  // end copy constructor
 
 
+// move constructor: takes over the chain of a_list, which is left empty
+template<class T, class Allocator>
+LinkedList<T, Allocator>::LinkedList(LinkedList<T, Allocator>&& a_list) noexcept :
+      head_ptr_(std::exchange(a_list.head_ptr_, nullptr)),
+      tail_ptr_(std::exchange(a_list.tail_ptr_, nullptr)),
+      item_count_(std::exchange(a_list.item_count_, 0)),
+      allocator_(std::move(a_list.allocator_))
+{
+}  // end move constructor
+
+
+// copy assignment
+template<class T, class Allocator>
+LinkedList<T, Allocator>& LinkedList<T, Allocator>::operator=(const LinkedList<T, Allocator>& a_list)
+{
+   if (this != &a_list)
+      *this = LinkedList<T, Allocator>(a_list);
+   return *this;
+}  // end copy assignment
+
+
+// move assignment: releases the current chain and takes over the chain of a_list
+template<class T, class Allocator>
+LinkedList<T, Allocator>& LinkedList<T, Allocator>::operator=(LinkedList<T, Allocator>&& a_list) noexcept
+{
+   if (this != &a_list)
+   {
+      clear();
+      head_ptr_ = std::exchange(a_list.head_ptr_, nullptr);
+      tail_ptr_ = std::exchange(a_list.tail_ptr_, nullptr);
+      item_count_ = std::exchange(a_list.item_count_, 0);
+      allocator_ = std::move(a_list.allocator_);
+   }
+   return *this;
+}  // end move assignment
+
+
 // destructor
-template<class T>
-LinkedList<T>::~LinkedList()
+template<class T, class Allocator>
+LinkedList<T, Allocator>::~LinkedList()
 {
    clear();
 }  // end destructor
@@ -71,16 +113,16 @@ LinkedList<T>::~LinkedList()
 
 
 /**@return true if list is empty - item_count_ == 0 */
-template<class T>
-bool LinkedList<T>::isEmpty() const
+template<class T, class Allocator>
+bool LinkedList<T, Allocator>::isEmpty() const
 {
    return item_count_ == 0;
 }  // end isEmpty
 
 
 /**@return the number of items in the list - item_count_ */
-template<class T>
-int LinkedList<T>::getLength() const
+template<class T, class Allocator>
+int LinkedList<T, Allocator>::getLength() const
 {
    return item_count_;
 }  // end getLength
@@ -93,14 +135,35 @@ int LinkedList<T>::getLength() const
  @param new_entry to be inserted in list
  @post new_entry is added at position in list (the node previously at that position is now at position+1)
  @return true if valid position (0 <= position <= item_count_) */
-template<class T>
-bool LinkedList<T>::insert(int positions, const T& new_entry)
+template<class T, class Allocator>
+bool LinkedList<T, Allocator>::insert(int position, const T& new_entry)
+{
+   return emplace(position, new_entry);
+}  // end insert
+
+template<class T, class Allocator>
+bool LinkedList<T, Allocator>::insert(int position, T&& new_entry)
+{
+   return emplace(position, std::move(new_entry));
+}  // end insert
+
+
+
+/**
+ @pre list positions follow traditional indexing from 0 to item_count_ -1
+ @param position indicating point of insertion
+ @param args forwarded to the constructor of T
+ @post an entry constructed in place from args is added at position in list
+ @return true if valid position (0 <= position <= item_count_) */
+template<class T, class Allocator>
+template<class... Args>
+bool LinkedList<T, Allocator>::emplace(int positions, Args&&... args)
 {
    bool able_to_insert = (positions >= 0) && (positions <= item_count_ );
    if (able_to_insert)
    {
-      // Create a new node containing the new entry
-      Node<T>* new_node_ptr = new Node<T>(new_entry);
+      // Create a new node, building the new entry in place
+      Node<T>* new_node_ptr = allocator_.create(std::in_place, std::forward<Args>(args)...);
 
       // Attach new node to chain
       if (positions == 0)
@@ -108,6 +171,14 @@ bool LinkedList<T>::insert(int positions, const T& new_entry)
          // Insert new node at beginning of chain
          new_node_ptr->setNext(head_ptr_);
          head_ptr_ = new_node_ptr;
+         if (tail_ptr_ == nullptr)
+            tail_ptr_ = new_node_ptr;
+      }
+      else if (positions == item_count_)
+      {
+         // Append after the last node without walking the chain
+         tail_ptr_->setNext(new_node_ptr);
+         tail_ptr_ = new_node_ptr;
       }
       else
       {
@@ -123,7 +194,7 @@ bool LinkedList<T>::insert(int positions, const T& new_entry)
    }  // end if
 
    return able_to_insert;
-}  // end insert
+}  // end emplace
 
 
 
@@ -132,8 +203,8 @@ bool LinkedList<T>::insert(int positions, const T& new_entry)
  @param position indicating point of deletion
  @post node at position is deleted, if any. List order is retains
  @return true if there is a node at position to be deleted, false otherwise */
-template<class T>
-bool LinkedList<T>::remove(int position)
+template<class T, class Allocator>
+bool LinkedList<T, Allocator>::remove(int position)
 {
    bool able_to_remove = (position >= 0) && (position < item_count_);
    if (able_to_remove)
@@ -144,6 +215,8 @@ bool LinkedList<T>::remove(int position)
          // Remove the first node in the chain
          cur_ptr = head_ptr_; // Save pointer to node
          head_ptr_ = head_ptr_->getNext();
+         if (head_ptr_ == nullptr)
+            tail_ptr_ = nullptr;
       }
       else
       {
@@ -156,11 +229,13 @@ bool LinkedList<T>::remove(int position)
          // Disconnect indicated node from chain by connecting the
          // prior node with the one after
          prev_ptr->setNext(cur_ptr->getNext());
+         if (cur_ptr == tail_ptr_)
+            tail_ptr_ = prev_ptr;
       }  // end if
 
       // Return node to system
       cur_ptr->setNext(nullptr);
-      delete cur_ptr;
+      allocator_.destroy(cur_ptr);
       cur_ptr = nullptr;
 
       item_count_--;  // Decrease count of entries
@@ -172,22 +247,55 @@ bool LinkedList<T>::remove(int position)
 
 
 /**@post the list is empty and item_count_ == 0*/
-template<class T>
-void LinkedList<T>::clear()
+template<class T, class Allocator>
+void LinkedList<T, Allocator>::clear()
 {
    while (!isEmpty())
       remove(0);
+   tail_ptr_ = nullptr;
 }  // end clear
 
 
+/**
+ @param new_entry to be inserted in list
+ @post new_entry is added at the end of the list, in constant time */
+template<class T, class Allocator>
+void LinkedList<T, Allocator>::pushBack(const T& new_entry)
+{
+   emplace(item_count_, new_entry);
+}  // end pushBack
+
+template<class T, class Allocator>
+void LinkedList<T, Allocator>::pushBack(T&& new_entry)
+{
+   emplace(item_count_, std::move(new_entry));
+}  // end pushBack
+
+
+/**
+ @param new_entry to be inserted in list
+ @post new_entry is added at the beginning of the list, in constant time */
+template<class T, class Allocator>
+void LinkedList<T, Allocator>::pushFront(const T& new_entry)
+{
+   emplace(0, new_entry);
+}  // end pushFront
+
+template<class T, class Allocator>
+void LinkedList<T, Allocator>::pushFront(T&& new_entry)
+{
+   emplace(0, std::move(new_entry));
+}  // end pushFront
+
+
 
 /**
  @pre list positions follow traditional indexing from 0 to item_count_ -1
  @param position indicating the position of the data to be retrieved
- @return data item found at position. If position is not a valid position < item_count_
+ @return reference to the data item found at position. If position is not a valid position < item_count_
  throws  PrecondViolatedExcep */
-template<class T>
-T LinkedList<T>::getEntry(int position) const
+template<class T, class Allocator>
+const T& LinkedList<T, Allocator>::getEntry(int position) const
 {
     // Enforce precondition
     bool ableToGet = (position >= 0) && (position < item_count_);
@@ -216,9 +324,13 @@ T LinkedList<T>::getEntry(int position) const
 // @param position the index of the desired node
 //       0 <= position < item_count_
 // @return  A pointer to the node at the given position or nullptr if position is >= item_count_
-template<class T>
-Node<T>* LinkedList<T>::getNodeAt(int position) const
+template<class T, class Allocator>
+Node<T>* LinkedList<T, Allocator>::getNodeAt(int position) const
 {
+    // The last node is always one hop away
+    if (position == item_count_ - 1)
+        return tail_ptr_;
+
     // Count from the beginning of the chain
     Node<T>* cur_ptr = head_ptr_;
     for (int skip = 0; skip < position; skip++)
@@ -229,8 +341,8 @@ Node<T>* LinkedList<T>::getNodeAt(int position) const
 
 //position follows classic indexing from 0 to item_count_-1
 //if position > item_count it returns nullptr
-template <class T>
-Node<T> *LinkedList<T>::getPointerTo(size_t position) const
+template <class T, class Allocator>
+Node<T> *LinkedList<T, Allocator>::getPointerTo(size_t position) const
 {
 
   Node<T> *find = nullptr;
@@ -249,13 +361,222 @@ Node<T> *LinkedList<T>::getPointerTo(size_t position) const
 
 
 
+//returns the allocator that owns the nodes of this list
+template <class T, class Allocator>
+const Allocator& LinkedList<T, Allocator>::getAllocator() const
+{
+  return allocator_;
+} //end getAllocator
+
+
 //returns the head pointer
-template <class T>
-Node<T> *LinkedList<T>::getHeadNode() const
+template <class T, class Allocator>
+Node<T> *LinkedList<T, Allocator>::getHeadNode() const
 {
 
   return head_ptr_;
 } //end getHeadNode
 
 
+/**@return iterator to the first entry, equal to end() if the list is empty */
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::iterator LinkedList<T, Allocator>::begin()
+{
+   return iterator(nullptr, head_ptr_);
+}  // end begin
+
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::const_iterator LinkedList<T, Allocator>::begin() const
+{
+   return const_iterator(nullptr, head_ptr_);
+}  // end begin
+
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::const_iterator LinkedList<T, Allocator>::cbegin() const
+{
+   return begin();
+}  // end cbegin
+
+
+/**@return iterator one past the last entry */
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::iterator LinkedList<T, Allocator>::end()
+{
+   return iterator(tail_ptr_, nullptr);
+}  // end end
+
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::const_iterator LinkedList<T, Allocator>::end() const
+{
+   return const_iterator(tail_ptr_, nullptr);
+}  // end end
+
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::const_iterator LinkedList<T, Allocator>::cend() const
+{
+   return end();
+}  // end cend
+
+
+/**
+ @param entry to be searched for
+ @return iterator to the first entry equal to entry, end() if there is none. Linear time */
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::iterator LinkedList<T, Allocator>::find(const T& entry)
+{
+   return std::find(begin(), end(), entry);
+}  // end find
+
+
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::const_iterator LinkedList<T, Allocator>::find(const T& entry) const
+{
+   return std::find(begin(), end(), entry);
+}  // end find
+
+
+/**
+ @pre position refers to an entry of this list (it is not end())
+ @param position iterator to the entry to be deleted
+ @post the entry is deleted in constant time. Iterators to the deleted entry
+       and to the entry after it are invalidated
+ @return iterator to the entry that followed the deleted one */
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::iterator LinkedList<T, Allocator>::erase(iterator position)
+{
+   Node<T>* prev_ptr = position.prev_ptr_;
+   Node<T>* cur_ptr = position.cur_ptr_;
+   assert(cur_ptr != nullptr);
+
+   Node<T>* next_ptr = cur_ptr->getNext();
+   if (prev_ptr == nullptr)
+      head_ptr_ = next_ptr;
+   else
+      prev_ptr->setNext(next_ptr);
+
+   if (cur_ptr == tail_ptr_)
+      tail_ptr_ = prev_ptr;
+
+   // Return node to system
+   cur_ptr->setNext(nullptr);
+   allocator_.destroy(cur_ptr);
+   item_count_--;
+
+   return iterator(prev_ptr, next_ptr);
+}  // end erase
+
+
+/**
+ @pre position refers to an entry of this list (it is not end())
+ @param position iterator to the entry after which to insert
+ @param new_entry to be inserted in list
+ @post new_entry is added right after position, in constant time. Iterators to
+       the entry that followed position are invalidated
+ @return iterator to the inserted entry */
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::iterator LinkedList<T, Allocator>::insertAfter(iterator position, const T& new_entry)
+{
+   return emplaceAfter(position, new_entry);
+}  // end insertAfter
+
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::iterator LinkedList<T, Allocator>::insertAfter(iterator position, T&& new_entry)
+{
+   return emplaceAfter(position, std::move(new_entry));
+}  // end insertAfter
+
+
+/**
+ @pre position refers to an entry of this list (it is not end())
+ @param position iterator to the entry after which to insert
+ @param args forwarded to the constructor of T
+ @post an entry constructed in place from args is added right after position,
+       in constant time. Iterators to the entry that followed position are invalidated
+ @return iterator to the inserted entry */
+template<class T, class Allocator>
+template<class... Args>
+typename LinkedList<T, Allocator>::iterator LinkedList<T, Allocator>::emplaceAfter(iterator position, Args&&... args)
+{
+   Node<T>* prev_ptr = position.cur_ptr_;
+   assert(prev_ptr != nullptr);
+
+   Node<T>* new_node_ptr = allocator_.create(std::in_place, std::forward<Args>(args)...);
+   new_node_ptr->setNext(prev_ptr->getNext());
+   prev_ptr->setNext(new_node_ptr);
+   if (prev_ptr == tail_ptr_)
+      tail_ptr_ = new_node_ptr;
+   item_count_++;
+
+   return iterator(prev_ptr, new_node_ptr);
+}  // end emplaceAfter
+
+
+/**
+ @pre position refers to an entry of this list (it is not end())
+ @param position iterator to the entry to be moved
+ @post the node of that entry is relinked at the head of the list, in constant
+       time and without allocating. Iterators to the entry that followed it
+       are invalidated
+ @return iterator to the moved entry, now equal to begin() */
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::iterator LinkedList<T, Allocator>::moveToFront(iterator position)
+{
+   Node<T>* prev_ptr = position.prev_ptr_;
+   Node<T>* cur_ptr = position.cur_ptr_;
+   assert(cur_ptr != nullptr);
+
+   if (prev_ptr != nullptr)  // Nothing to do if already at the head
+   {
+      // Unlink the node
+      prev_ptr->setNext(cur_ptr->getNext());
+      if (cur_ptr == tail_ptr_)
+         tail_ptr_ = prev_ptr;
+
+      // Relink it at the beginning of the chain
+      cur_ptr->setNext(head_ptr_);
+      head_ptr_ = cur_ptr;
+   }  // end if
+
+   return iterator(nullptr, cur_ptr);
+}  // end moveToFront
+
+
+/**
+ @pre position and source refer to entries of this list (neither is end())
+ @param position iterator to the entry after which to relink
+ @param source iterator to the entry to be moved
+ @post the node of source is relinked right after position, in constant time
+       and without allocating. Iterators to the entries that followed source
+       and position are invalidated
+ @return iterator to the moved entry */
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::iterator LinkedList<T, Allocator>::spliceAfter(iterator position, iterator source)
+{
+   Node<T>* target_ptr = position.cur_ptr_;
+   Node<T>* prev_ptr = source.prev_ptr_;
+   Node<T>* cur_ptr = source.cur_ptr_;
+   assert(target_ptr != nullptr && cur_ptr != nullptr);
+
+   // Nothing to do if the node is the target or already follows it
+   if (cur_ptr == target_ptr || prev_ptr == target_ptr)
+      return iterator(prev_ptr, cur_ptr);
+
+   // Unlink the node
+   if (prev_ptr == nullptr)
+      head_ptr_ = cur_ptr->getNext();
+   else
+      prev_ptr->setNext(cur_ptr->getNext());
+   if (cur_ptr == tail_ptr_)
+      tail_ptr_ = prev_ptr;
+
+   // Relink it after the target node
+   cur_ptr->setNext(target_ptr->getNext());
+   target_ptr->setNext(cur_ptr);
+   if (target_ptr == tail_ptr_)
+      tail_ptr_ = cur_ptr;
+
+   return iterator(target_ptr, cur_ptr);
+}  // end spliceAfter
+
+
 //  End of implementation file.
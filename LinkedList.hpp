@@ -13,16 +13,91 @@
 #ifndef LINKED_LIST_
 #define LINKED_LIST_
 
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
 #include "Node.hpp"
+#include "NodeAllocator.hpp"
 #include "PrecondViolatedExcep.hpp"
 
-template<class T>
+/** @param T type of the entries
+    @param Allocator creates and destroys the nodes of the chain. The default
+           uses new/delete; PoolNodeAllocator<T> recycles nodes from chunks */
+template<class T, class Allocator = NewNodeAllocator<T>>
 class LinkedList
 {
 
 public:
+   /** Forward iterator over the entries of the list.
+       Besides the current node it remembers the node before it, so that
+       erase(it) can unlink the entry without walking the chain again.
+       @param IsConst true for const_iterator, false for iterator */
+   template<bool IsConst>
+   class ListIterator
+   {
+   public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = T;
+      using difference_type = std::ptrdiff_t;
+      using pointer = std::conditional_t<IsConst, const T*, T*>;
+      using reference = std::conditional_t<IsConst, const T&, T&>;
+
+      ListIterator() : prev_ptr_(nullptr), cur_ptr_(nullptr) {}
+
+      // an iterator converts to a const_iterator, never the other way around
+      template<bool WasConst, class = std::enable_if_t<IsConst && !WasConst>>
+      ListIterator(const ListIterator<WasConst>& other) :
+            prev_ptr_(other.prev_ptr_), cur_ptr_(other.cur_ptr_) {}
+
+      reference operator*() const { return cur_ptr_->getItem(); }
+      pointer operator->() const { return &cur_ptr_->getItem(); }
+
+      ListIterator& operator++()
+      {
+         prev_ptr_ = cur_ptr_;
+         cur_ptr_ = cur_ptr_->getNext();
+         return *this;
+      }
+
+      ListIterator operator++(int)
+      {
+         ListIterator old = *this;
+         ++(*this);
+         return old;
+      }
+
+      friend bool operator==(const ListIterator& lhs, const ListIterator& rhs)
+      {
+         return lhs.cur_ptr_ == rhs.cur_ptr_;
+      }
+
+      friend bool operator!=(const ListIterator& lhs, const ListIterator& rhs)
+      {
+         return lhs.cur_ptr_ != rhs.cur_ptr_;
+      }
+
+      /**@return the node the iterator refers to, nullptr for end() */
+      Node<T>* getNode() const { return cur_ptr_; }
+
+   private:
+      friend class LinkedList<T, Allocator>;
+      template<bool> friend class ListIterator;
+
+      ListIterator(Node<T>* prev_ptr, Node<T>* cur_ptr) :
+            prev_ptr_(prev_ptr), cur_ptr_(cur_ptr) {}
+
+      Node<T>* prev_ptr_; // node before cur_ptr_, nullptr at the head
+      Node<T>* cur_ptr_;  // current node, nullptr past the end
+   }; // end ListIterator
+
+   using iterator = ListIterator<false>;
+   using const_iterator = ListIterator<true>;
+
    LinkedList(); // constructor
-   LinkedList(const LinkedList<T>& a_list); // copy constructor
+   LinkedList(const LinkedList<T, Allocator>& a_list); // copy constructor
+   LinkedList(LinkedList<T, Allocator>&& a_list) noexcept; // move constructor, a_list is left empty
+   LinkedList<T, Allocator>& operator=(const LinkedList<T, Allocator>& a_list); // copy assignment
+   LinkedList<T, Allocator>& operator=(LinkedList<T, Allocator>&& a_list) noexcept; // move assignment, a_list is left empty
    virtual ~LinkedList(); // destructor
 
    /**@return true if list is empty - item_count_ == 0 */
@@ -39,6 +114,28 @@ public:
      @post new_entry is added at position in list (the node previously at that position is now at position+1)
      @return true if valid position (0 <= position <= item_count_) */
    bool insert(int position, const T& new_entry);
+   bool insert(int position, T&& new_entry);
+
+    /**
+     @pre list positions follow traditional indexing from 0 to item_count_ -1
+     @param position indicating point of insertion
+     @param args forwarded to the constructor of T
+     @post an entry constructed in place from args is added at position in list
+     @return true if valid position (0 <= position <= item_count_) */
+   template<class... Args>
+   bool emplace(int position, Args&&... args);
+
+    /**
+     @param new_entry to be inserted in list
+     @post new_entry is added at the end of the list, in constant time */
+   void pushBack(const T& new_entry);
+   void pushBack(T&& new_entry);
+
+    /**
+     @param new_entry to be inserted in list
+     @post new_entry is added at the beginning of the list, in constant time */
+   void pushFront(const T& new_entry);
+   void pushFront(T&& new_entry);
 
 
     /**
@@ -57,15 +154,81 @@ public:
     /**
      @pre list positions follow traditional indexing from 0 to item_count_ -1
      @param position indicating the position of the data to be retrieved
-     @return data item found at position. If position is not a valid position < item_count_
+     @return reference to the data item found at position. If position is not a valid position < item_count_
             throws  PrecondViolatedExcep */
-   T getEntry(int position) const;
+   const T& getEntry(int position) const;
 
         //if position > item_count_ returns nullptr
     Node<T> *getPointerTo(size_t position) const;
 
     Node<T> *getHeadNode() const;
 
+   /**@return the allocator that owns the nodes of this list */
+   const Allocator& getAllocator() const;
+
+   /**@return iterator to the first entry, equal to end() if the list is empty */
+   iterator begin();
+   const_iterator begin() const;
+   const_iterator cbegin() const;
+
+   /**@return iterator one past the last entry */
+   iterator end();
+   const_iterator end() const;
+   const_iterator cend() const;
+
+    /**
+     @param entry to be searched for
+     @return iterator to the first entry equal to entry, end() if there is none. Linear time */
+   iterator find(const T& entry);
+   const_iterator find(const T& entry) const;
+
+    /**
+     @pre position refers to an entry of this list (it is not end())
+     @param position iterator to the entry to be deleted
+     @post the entry is deleted in constant time. Iterators to the deleted entry
+           and to the entry after it are invalidated
+     @return iterator to the entry that followed the deleted one */
+   iterator erase(iterator position);
+
+    /**
+     @pre position refers to an entry of this list (it is not end())
+     @param position iterator to the entry after which to insert
+     @param new_entry to be inserted in list
+     @post new_entry is added right after position, in constant time. Iterators to
+           the entry that followed position are invalidated
+     @return iterator to the inserted entry */
+   iterator insertAfter(iterator position, const T& new_entry);
+   iterator insertAfter(iterator position, T&& new_entry);
+
+    /**
+     @pre position refers to an entry of this list (it is not end())
+     @param position iterator to the entry after which to insert
+     @param args forwarded to the constructor of T
+     @post an entry constructed in place from args is added right after position,
+           in constant time. Iterators to the entry that followed position are invalidated
+     @return iterator to the inserted entry */
+   template<class... Args>
+   iterator emplaceAfter(iterator position, Args&&... args);
+
+    /**
+     @pre position refers to an entry of this list (it is not end())
+     @param position iterator to the entry to be moved
+     @post the node of that entry is relinked at the head of the list, in constant
+           time and without allocating. Iterators to the entry that followed it
+           are invalidated
+     @return iterator to the moved entry, now equal to begin() */
+   iterator moveToFront(iterator position);
+
+    /**
+     @pre position and source refer to entries of this list (neither is end())
+     @param position iterator to the entry after which to relink
+     @param source iterator to the entry to be moved
+     @post the node of source is relinked right after position, in constant time
+           and without allocating. Iterators to the entries that followed source
+           and position are invalidated
+     @return iterator to the moved entry */
+   iterator spliceAfter(iterator position, iterator source);
+
 
 
 
@@ -73,7 +236,9 @@ public:
 protected:
     Node<T>* head_ptr_; // Pointer to first node in the chain;
     // (contains the first entry in the list)
+    Node<T>* tail_ptr_; // Pointer to last node in the chain (nullptr if empty)
     int item_count_;           // Current count of list items
+    Allocator allocator_;      // Creates and destroys the nodes of the chain
 
 
 
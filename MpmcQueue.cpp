@@ -0,0 +1,117 @@
+/** ADT queue: bounded multi-producer multi-consumer implementation.
+
+ Implementation file for the class MpmcQueue.
+ @file MpmcQueue.cpp */
+
+#include "MpmcQueue.hpp"  // Header file
+#include <new>
+#include <utility>
+
+// constructor
+template<class T>
+MpmcQueue<T>::MpmcQueue(std::size_t capacity) : enqueue_turn_(0), dequeue_turn_(0)
+{
+   std::size_t cell_count = 2;
+   while (cell_count < capacity)
+   {
+      cell_count *= 2;
+   }
+   cells_.reset(new Cell[cell_count]);
+   mask_ = cell_count - 1;
+   for (std::size_t i = 0; i < cell_count; i++)
+   {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+   }
+}  // end constructor
+
+
+// destructor
+template<class T>
+MpmcQueue<T>::~MpmcQueue()
+{
+   T entry;
+   while (tryPop(entry))
+   {
+   }
+}  // end destructor
+
+
+/** May be called from several threads at once.
+ @param new_entry to be added at the back of the queue
+ @post new_entry is moved into the queue, unless it is full
+ @return true if the entry was added, false if the queue was full (new_entry is unchanged) */
+template<class T>
+bool MpmcQueue<T>::tryPush(T&& new_entry)
+{
+   std::size_t turn = enqueue_turn_.load(std::memory_order_relaxed);
+   Cell* cell;
+   while (true)
+   {
+      cell = &cells_[turn & mask_];
+      std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+      if (sequence == turn)
+      {
+         // Free for this turn: claim it, or learn which turn is next
+         if (enqueue_turn_.compare_exchange_weak(turn, turn + 1, std::memory_order_relaxed))
+         {
+            break;
+         }
+      }
+      else if (sequence < turn)
+      {
+         return false;  // Still holds the entry of the previous lap: full
+      }
+      else
+      {
+         turn = enqueue_turn_.load(std::memory_order_relaxed);  // Another producer took this turn
+      }
+   }
+   ::new (static_cast<void*>(&cell->storage)) T(std::move(new_entry));
+   cell->sequence.store(turn + 1, std::memory_order_release);  // Publishes the entry to the consumer of this turn
+   return true;
+}  // end tryPush
+
+
+/** May be called from several threads at once.
+ @param entry set to the entry at the front of the queue, if any
+ @post the entry is removed from the queue
+ @return true if an entry was removed, false if the queue was empty */
+template<class T>
+bool MpmcQueue<T>::tryPop(T& entry)
+{
+   std::size_t turn = dequeue_turn_.load(std::memory_order_relaxed);
+   Cell* cell;
+   while (true)
+   {
+      cell = &cells_[turn & mask_];
+      std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+      if (sequence == turn + 1)
+      {
+         if (dequeue_turn_.compare_exchange_weak(turn, turn + 1, std::memory_order_relaxed))
+         {
+            break;
+         }
+      }
+      else if (sequence < turn + 1)
+      {
+         return false;  // Not yet filled for this turn: empty
+      }
+      else
+      {
+         turn = dequeue_turn_.load(std::memory_order_relaxed);  // Another consumer took this turn
+      }
+   }
+   T* stored = reinterpret_cast<T*>(&cell->storage);
+   entry = std::move(*stored);
+   stored->~T();
+   cell->sequence.store(turn + mask_ + 1, std::memory_order_release);  // Free for the producer one lap later
+   return true;
+}  // end tryPop
+
+
+/**@return the number of entries the queue holds at most */
+template<class T>
+std::size_t MpmcQueue<T>::capacity() const
+{
+   return mask_ + 1;
+}  // end capacity
@@ -0,0 +1,60 @@
+/** ADT queue: bounded multi-producer multi-consumer implementation.
+    A ring of cells, each stamped with a sequence number that tells a producer
+    whether the cell is free for its turn and a consumer whether it is full for
+    its turn. Producers and consumers claim turns with a compare-and-swap on
+    their own counter, so none of them ever holds a lock, and an operation that
+    would have to wait fails instead.
+    @file MpmcQueue.hpp */
+
+#ifndef MPMC_QUEUE_
+#define MPMC_QUEUE_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+/** @param T type of the entries, which must be default constructible and movable */
+template<class T>
+class MpmcQueue
+{
+public:
+   /** @param capacity the number of entries the queue holds at most, rounded up to a power of two (at least 2)
+       @post the queue is empty; all its cells are allocated up front */
+   explicit MpmcQueue(std::size_t capacity);
+   MpmcQueue(const MpmcQueue& other) = delete;
+   MpmcQueue& operator=(const MpmcQueue& other) = delete;
+   ~MpmcQueue(); // destroys the entries still queued
+
+   /** May be called from several threads at once.
+       @param new_entry to be added at the back of the queue
+       @post new_entry is moved into the queue, unless it is full
+       @return true if the entry was added, false if the queue was full (new_entry is unchanged) */
+   bool tryPush(T&& new_entry);
+
+   /** May be called from several threads at once.
+       @param entry set to the entry at the front of the queue, if any
+       @post the entry is removed from the queue
+       @return true if an entry was removed, false if the queue was empty */
+   bool tryPop(T& entry);
+
+   /**@return the number of entries the queue holds at most */
+   std::size_t capacity() const;
+
+private:
+   struct Cell
+   {
+      std::atomic<std::size_t> sequence; // == turn when free for the producer of that turn, turn + 1 when full
+      typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+   }; // end Cell
+
+   static constexpr std::size_t CACHE_LINE = 64;
+
+   std::unique_ptr<Cell[]> cells_;
+   std::size_t mask_; // capacity - 1
+   alignas(CACHE_LINE) std::atomic<std::size_t> enqueue_turn_; // next turn to push, apart from the consumers' counter
+   alignas(CACHE_LINE) std::atomic<std::size_t> dequeue_turn_; // next turn to pop
+}; // end MpmcQueue
+
+#include "MpmcQueue.cpp"
+#endif
@@ -29,6 +29,28 @@ Node<T>::Node(const T& an_item, Node<T>* next_node_ptr) :
 {
 } // end constructor
 
+//parameterized constructor, moves an_item
+template<class T>
+Node<T>::Node(T&& an_item) : item_(std::move(an_item)), next_(nullptr)
+{
+} // end constructor
+
+//parameterized constructor, moves an_item
+template<class T>
+Node<T>::Node(T&& an_item, Node<T>* next_node_ptr) :
+                item_(std::move(an_item)), next_(next_node_ptr)
+{
+} // end constructor
+
+/** @param args  forwarded to the constructor of T
+ @post item_ is constructed in place from args, next_ is nullptr */
+template<class T>
+template<class... Args>
+Node<T>::Node(std::in_place_t, Args&&... args) :
+                item_(std::forward<Args>(args)...), next_(nullptr)
+{
+} // end constructor
+
 
 /** @param an_item contained in the node
  @post sets item_ to an_item */
@@ -38,6 +60,14 @@ void Node<T>::setItem(const T& an_item)
    item_ = an_item;
 } // end setItem
 
+/** @param an_item contained in the node
+ @post moves an_item into item_ */
+template<class T>
+void Node<T>::setItem(T&& an_item)
+{
+   item_ = std::move(an_item);
+} // end setItem
+
 
 /** @param next_node_ptr points to the next node in the chain
  @post sets next_ to next_node_ptr */
@@ -47,9 +77,15 @@ void Node<T>::setNext(Node<T>* next_node_ptr)
    next_ = next_node_ptr;
 } // end setNext
 
- /**@return item_*/
+ /**@return a reference to item_, no copy is made*/
+template<class T>
+const T& Node<T>::getItem() const
+{
+   return item_;
+} // end getItem
+
 template<class T>
-T Node<T>::getItem() const
+T& Node<T>::getItem()
 {
    return item_;
 } // end getItem
@@ -8,6 +8,8 @@
 #ifndef NODE_
 #define NODE_
 
+#include <utility>
+
 template<class T>
 class Node
 {
@@ -15,17 +17,29 @@ public:
    Node();  //default constructor
    Node(const T& an_item); //parameterized constructor
    Node(const T& an_item, Node<T>* next_node_ptr); //parameterized constructor
+   Node(T&& an_item); //parameterized constructor, moves an_item
+   Node(T&& an_item, Node<T>* next_node_ptr); //parameterized constructor, moves an_item
+
+   /** @param args  forwarded to the constructor of T
+        @post item_ is constructed in place from args, next_ is nullptr */
+   template<class... Args>
+   explicit Node(std::in_place_t, Args&&... args);
 
    /** @param an_item  contained in the node
         @post sets item_ to an_item */
    void setItem(const T& an_item);
+
+   /** @param an_item  contained in the node
+        @post moves an_item into item_ */
+   void setItem(T&& an_item);
     
     /** @param next_node_ptr points to the next node in the chain
      @post sets next_ to next_node_ptr */
    void setNext(Node<T>* next_node_ptr);
     
-    /**@return item_*/
-   T getItem() const ;
+    /**@return a reference to item_, no copy is made*/
+   const T& getItem() const ;
+   T& getItem();
     
     /**@return next_*/
    Node<T>* getNext() const ;
@@ -0,0 +1,128 @@
+/** @file NodeAllocator.cpp
+    Implementation file for the node allocators of LinkedList. */
+
+#include "NodeAllocator.hpp"
+#include <cassert>
+#include <new>
+#include <utility>
+
+/** @param args forwarded to the Node<T> constructor
+    @return a new node allocated on the heap */
+template<class T>
+template<class... Args>
+Node<T>* NewNodeAllocator<T>::create(Args&&... args)
+{
+   return new Node<T>(std::forward<Args>(args)...);
+} // end create
+
+/** @param node_ptr a node returned by create()
+    @post the node is destroyed and its memory returned to the system */
+template<class T>
+void NewNodeAllocator<T>::destroy(Node<T>* node_ptr)
+{
+   delete node_ptr;
+} // end destroy
+
+
+
+template<class T, std::size_t NODES_PER_CHUNK>
+PoolNodeAllocator<T, NODES_PER_CHUNK>::PoolNodeAllocator() :
+      free_list_(nullptr), next_unused_(NODES_PER_CHUNK), nodes_in_use_(0),
+      nodes_free_(0), allocations_(0), recycled_(0)
+{
+} // end default constructor
+
+// takes over the chunks of other, which is left empty
+template<class T, std::size_t NODES_PER_CHUNK>
+PoolNodeAllocator<T, NODES_PER_CHUNK>::PoolNodeAllocator(PoolNodeAllocator&& other) noexcept :
+      chunks_(std::move(other.chunks_)),
+      free_list_(std::exchange(other.free_list_, nullptr)),
+      next_unused_(std::exchange(other.next_unused_, NODES_PER_CHUNK)),
+      nodes_in_use_(std::exchange(other.nodes_in_use_, 0)),
+      nodes_free_(std::exchange(other.nodes_free_, 0)),
+      allocations_(std::exchange(other.allocations_, 0)),
+      recycled_(std::exchange(other.recycled_, 0))
+{
+   other.chunks_.clear();
+} // end move constructor
+
+// all nodes of this pool must be destroyed first; takes over the chunks of other
+template<class T, std::size_t NODES_PER_CHUNK>
+PoolNodeAllocator<T, NODES_PER_CHUNK>& PoolNodeAllocator<T, NODES_PER_CHUNK>::operator=(PoolNodeAllocator&& other) noexcept
+{
+   assert(nodes_in_use_ == 0);
+   if (this != &other)
+   {
+      chunks_ = std::move(other.chunks_);
+      other.chunks_.clear();
+      free_list_ = std::exchange(other.free_list_, nullptr);
+      next_unused_ = std::exchange(other.next_unused_, NODES_PER_CHUNK);
+      nodes_in_use_ = std::exchange(other.nodes_in_use_, 0);
+      nodes_free_ = std::exchange(other.nodes_free_, 0);
+      allocations_ = std::exchange(other.allocations_, 0);
+      recycled_ = std::exchange(other.recycled_, 0);
+   }
+   return *this;
+} // end move assignment
+
+template<class T, std::size_t NODES_PER_CHUNK>
+PoolNodeAllocator<T, NODES_PER_CHUNK>::~PoolNodeAllocator()
+{
+   assert(nodes_in_use_ == 0);
+} // end destructor
+
+/** @param args forwarded to the Node<T> constructor
+    @return a node built in a recycled slot, or in a fresh one
+            (a new chunk is obtained only when the current one is exhausted) */
+template<class T, std::size_t NODES_PER_CHUNK>
+template<class... Args>
+Node<T>* PoolNodeAllocator<T, NODES_PER_CHUNK>::create(Args&&... args)
+{
+   Slot* slot = acquireSlot();
+   Node<T>* node_ptr = new (slot->storage_) Node<T>(std::forward<Args>(args)...);
+   nodes_in_use_++;
+   allocations_++;
+   return node_ptr;
+} // end create
+
+/** @param node_ptr a node returned by create() on this allocator
+    @post the node is destroyed and its slot goes onto the free list */
+template<class T, std::size_t NODES_PER_CHUNK>
+void PoolNodeAllocator<T, NODES_PER_CHUNK>::destroy(Node<T>* node_ptr)
+{
+   node_ptr->~Node<T>();
+   Slot* slot = reinterpret_cast<Slot*>(node_ptr);
+   slot->next_free_ = free_list_;
+   free_list_ = slot;
+   nodes_in_use_--;
+   nodes_free_++;
+} // end destroy
+
+/**@return chunk and node usage counters */
+template<class T, std::size_t NODES_PER_CHUNK>
+PoolStats PoolNodeAllocator<T, NODES_PER_CHUNK>::getStats() const
+{
+   return PoolStats{chunks_.size(), NODES_PER_CHUNK, nodes_in_use_, nodes_free_,
+                    allocations_, recycled_};
+} // end getStats
+
+// @return an uninitialized slot, taken from the free list when possible
+template<class T, std::size_t NODES_PER_CHUNK>
+typename PoolNodeAllocator<T, NODES_PER_CHUNK>::Slot* PoolNodeAllocator<T, NODES_PER_CHUNK>::acquireSlot()
+{
+   if (free_list_ != nullptr)
+   {
+      Slot* slot = free_list_;
+      free_list_ = slot->next_free_;
+      nodes_free_--;
+      recycled_++;
+      return slot;
+   }
+
+   if (next_unused_ == NODES_PER_CHUNK)
+   {
+      chunks_.emplace_back(new Slot[NODES_PER_CHUNK]);
+      next_unused_ = 0;
+   }
+   return &chunks_.back()[next_unused_++];
+} // end acquireSlot
@@ -0,0 +1,88 @@
+/** @file NodeAllocator.hpp
+    Node allocators for LinkedList.
+
+    NewNodeAllocator allocates every node with new and releases it with delete.
+    PoolNodeAllocator carves nodes out of contiguous chunks and keeps released
+    nodes on a free list so that they are recycled by the next allocation. */
+
+#ifndef NODE_ALLOCATOR_
+#define NODE_ALLOCATOR_
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "Node.hpp"
+
+template<class T>
+class NewNodeAllocator
+{
+public:
+   /** @param args forwarded to the Node<T> constructor
+       @return a new node allocated on the heap */
+   template<class... Args>
+   Node<T>* create(Args&&... args);
+
+   /** @param node_ptr a node returned by create()
+       @post the node is destroyed and its memory returned to the system */
+   void destroy(Node<T>* node_ptr);
+}; // end NewNodeAllocator
+
+
+/** Chunk usage of a PoolNodeAllocator */
+struct PoolStats
+{
+   std::size_t chunk_count;     // chunks obtained from the system
+   std::size_t nodes_per_chunk; // nodes carved out of each chunk
+   std::size_t nodes_in_use;    // nodes currently handed out
+   std::size_t nodes_free;      // nodes waiting on the free list
+   std::size_t allocations;     // calls to create()
+   std::size_t recycled;        // calls to create() served from the free list
+}; // end PoolStats
+
+
+template<class T, std::size_t NODES_PER_CHUNK = 64>
+class PoolNodeAllocator
+{
+public:
+   PoolNodeAllocator();
+   PoolNodeAllocator(const PoolNodeAllocator& other) = delete;
+   PoolNodeAllocator& operator=(const PoolNodeAllocator& other) = delete;
+   PoolNodeAllocator(PoolNodeAllocator&& other) noexcept; // takes over the chunks of other
+   PoolNodeAllocator& operator=(PoolNodeAllocator&& other) noexcept; // all nodes of this pool must be destroyed first
+   ~PoolNodeAllocator(); // releases every chunk; all nodes must be destroyed first
+
+   /** @param args forwarded to the Node<T> constructor
+       @return a node built in a recycled slot, or in a fresh one
+               (a new chunk is obtained only when the current one is exhausted) */
+   template<class... Args>
+   Node<T>* create(Args&&... args);
+
+   /** @param node_ptr a node returned by create() on this allocator
+       @post the node is destroyed and its slot goes onto the free list */
+   void destroy(Node<T>* node_ptr);
+
+   /**@return chunk and node usage counters */
+   PoolStats getStats() const;
+
+private:
+   // A slot holds either a live node or a link in the free list
+   union Slot
+   {
+      Slot* next_free_;
+      alignas(Node<T>) unsigned char storage_[sizeof(Node<T>)];
+   };
+
+   std::vector<std::unique_ptr<Slot[]>> chunks_;
+   Slot* free_list_;         // released slots, most recent first
+   std::size_t next_unused_; // first never-used slot of the newest chunk
+   std::size_t nodes_in_use_;
+   std::size_t nodes_free_;
+   std::size_t allocations_;
+   std::size_t recycled_;
+
+   // @return an uninitialized slot, taken from the free list when possible
+   Slot* acquireSlot();
+}; // end PoolNodeAllocator
+
+#include "NodeAllocator.cpp"
+#endif
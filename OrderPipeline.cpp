@@ -0,0 +1,390 @@
+/**
+ * @file OrderPipeline.cpp
+ * @brief This file contains the implementation of the OrderPipeline class, which executes orders against a station manager on worker threads in a virtual bistro simulation.
+ *
+ * The router is the only producer of every lane and the worker holding it its only consumer, so the lanes need no
+ * compare-and-swap. Idle threads sleep on a condition variable, and are woken only when their count of pending
+ * orders leaves zero.
+ *
+ * Under WORK_STEALING each lane counts the orders the router put in it. The router schedules the lane when that count
+ * leaves zero; the worker holding it counts down what it took, and lets the lane go only when that brings the count
+ * back to zero. Both sides change the count with one atomic operation, so a lane is never scheduled twice, nor left
+ * unscheduled with orders in it. A worker takes no more orders than it saw counted, so the count never goes below the
+ * orders actually in the queue.
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#include "OrderPipeline.hpp"
+#include <algorithm>  // For std::max, std::min
+#include <utility>    // For std::move
+
+/**
+ * Parameterized Constructor
+ * @param manager The station manager whose stations take the orders.
+ * @param worker_count The number of worker threads (at least 1, at most one per station).
+ * @param scheduling How the lanes are shared among the workers.
+ * @param queue_capacity The number of orders the submission queue holds before producers have to wait.
+ * @pre: No other thread is using the manager. No station is removed from it while the pipeline runs.
+ * @post: Starts the router and the workers. Each station on the floor now gets a lane, assigned to the workers in
+list order; stations added later get no orders from the pipeline. A manager in SINGLE_THREADED mode is put in LOCKED
+mode until the pipeline stops.
+*/
+template<class List>
+BasicOrderPipeline<List>::BasicOrderPipeline(BasicStationManager<List>& manager, std::size_t worker_count,
+                                             Scheduling scheduling, std::size_t queue_capacity)
+    : manager_(manager), submissions_(queue_capacity), scheduling_(scheduling), router_stopping_(false),
+      workers_stopping_(false), stopped_(false), previous_mode_(manager.getConcurrencyMode()) {
+    if (previous_mode_ == KitchenStation::SINGLE_THREADED) {
+        manager_.setConcurrencyMode(KitchenStation::LOCKED);  // The router reads stations the workers change
+    }
+    const std::size_t stations = static_cast<std::size_t>(manager_.getLength());
+    worker_count = std::max<std::size_t>(1, std::min(worker_count, stations));
+    for (std::size_t i = 0; i < worker_count; i++) {
+        workers_.emplace_back(new Worker(i, std::max<std::size_t>(1, stations)));
+    }
+    for (KitchenStation* station : manager_) {
+        std::size_t worker = lanes_.size() % worker_count;
+        lanes_.emplace_back(new Lane(station, worker));
+        lane_of_[station] = lanes_.back().get();
+        workers_[worker]->lanes.push_back(lanes_.back().get());
+    }
+    for (auto& worker : workers_) {
+        Worker* owner = worker.get();
+        if (scheduling_ == WORK_STEALING) {
+            worker->thread = std::thread([this, owner] { runStealingWorker(*owner); });
+        } else {
+            worker->thread = std::thread([this, owner] { runWorker(*owner); });
+        }
+    }
+    router_ = std::thread([this] { runRouter(); });
+}
+
+/**
+ * Destructor
+ * @post: Stops the pipeline, as stop does.
+*/
+template<class List>
+BasicOrderPipeline<List>::~BasicOrderPipeline() {
+    stop();
+}
+
+/**
+ * Submits an order for one serving of a dish, at any station able to prepare it.
+ * @param dish_name A string representing the name of the dish.
+ * @post: The order is queued, waiting while the queue is full.
+ * @return: A future for its outcome. The station is picked when the order is routed, among those able to complete it
+at that point.
+*/
+template<class List>
+std::future<typename BasicOrderPipeline<List>::OrderResult> BasicOrderPipeline<List>::submit(const std::string& dish_name) {
+    return submit("", dish_name, 1);
+}
+
+/**
+ * Submits an order for servings of a dish.
+ * @param station_name A string representing the station's name; an empty name lets the router pick any station able
+to prepare it.
+ * @param dish_name A string representing the name of the dish.
+ * @param count The number of servings to prepare, all or none.
+ * @post: The order is queued, waiting while the queue is full.
+ * @return: A future for its outcome.
+*/
+template<class List>
+std::future<typename BasicOrderPipeline<List>::OrderResult> BasicOrderPipeline<List>::submit(
+    const std::string& station_name, const std::string& dish_name, int count) {
+    Ticket ticket;
+    ticket.promise.emplace();
+    std::future<OrderResult> outcome = ticket.promise->get_future();
+    ticket.any_station = station_name.empty();
+    ticket.count = count;
+    if (!Symbol::find(dish_name, ticket.dish_name) ||
+        (!ticket.any_station && !Symbol::find(station_name, ticket.station_name))) {
+        complete(ticket, OrderResult{nullptr, {KitchenStation::PrepareResult::NOT_ASSIGNED, ""}});  // Never interned
+        return outcome;
+    }
+    enqueue(std::move(ticket));
+    return outcome;
+}
+
+/**
+ * Submits an order for servings of a dish, to be reported through a callback.
+ * @param station_name A string representing the station's name; an empty name lets the router pick any station able
+to prepare it.
+ * @param dish_name A string representing the name of the dish.
+ * @param count The number of servings to prepare, all or none.
+ * @param on_done Called once with the outcome, on the worker that prepared the order (or on this thread if the names
+are unknown). It must not throw.
+ * @post: The order is queued, waiting while the queue is full.
+*/
+template<class List>
+void BasicOrderPipeline<List>::submit(const std::string& station_name, const std::string& dish_name, int count,
+                                      Callback on_done) {
+    Ticket ticket;
+    ticket.on_done = std::move(on_done);
+    ticket.any_station = station_name.empty();
+    ticket.count = count;
+    if (!Symbol::find(dish_name, ticket.dish_name) ||
+        (!ticket.any_station && !Symbol::find(station_name, ticket.station_name))) {
+        complete(ticket, OrderResult{nullptr, {KitchenStation::PrepareResult::NOT_ASSIGNED, ""}});
+        return;
+    }
+    enqueue(std::move(ticket));
+}
+
+/**
+ * Stops the pipeline once every order submitted so far is done.
+ * @pre: No thread is submitting orders, now or later. If the pipeline put the manager in LOCKED mode, no other thread
+is using the manager either.
+ * @post: The router and the workers have finished, and the manager is back in the concurrency mode it had before the
+pipeline started. Calling stop again does nothing.
+*/
+template<class List>
+void BasicOrderPipeline<List>::stop() {
+    if (stopped_) {
+        return;
+    }
+    stopped_ = true;
+    // The router drains the submissions first, so that the workers see every order before they are told to stop
+    router_stopping_.store(true);
+    router_signal_.interrupt();
+    router_.join();
+    workers_stopping_.store(true);
+    ready_.interrupt();
+    for (auto& worker : workers_) {
+        worker->signal.interrupt();
+    }
+    for (auto& worker : workers_) {
+        worker->thread.join();
+    }
+    if (manager_.getConcurrencyMode() != previous_mode_) {
+        manager_.setConcurrencyMode(previous_mode_);  // The pipeline's threads no longer use the stations
+    }
+}
+
+/**
+ * @return: The number of worker threads.
+*/
+template<class List>
+std::size_t BasicOrderPipeline<List>::getWorkerCount() const {
+    return workers_.size();
+}
+
+/**
+ * @return: How the lanes are shared among the workers.
+*/
+template<class List>
+typename BasicOrderPipeline<List>::Scheduling BasicOrderPipeline<List>::getScheduling() const {
+    return scheduling_;
+}
+
+/**
+ * @post: One more item is pending; the thread is woken if it may be sleeping.
+*/
+template<class List>
+void BasicOrderPipeline<List>::Signal::post() {
+    if (pending.fetch_add(1, std::memory_order_acq_rel) == 0) {
+        // The thread only sleeps with nothing pending; taking the mutex keeps the wake-up from slipping in between
+        // its check and its wait
+        std::lock_guard<std::mutex> lock(mutex);
+        wake.notify_one();
+    }
+}
+
+/**
+ * Waits until an item is pending or the thread is told to stop.
+ * @param stopping Set when the thread should stop once idle.
+ * @return: True if an item is pending; false if the thread should stop.
+*/
+template<class List>
+bool BasicOrderPipeline<List>::Signal::wait(const std::atomic<bool>& stopping) {
+    std::unique_lock<std::mutex> lock(mutex);
+    wake.wait(lock, [&] { return pending.load(std::memory_order_acquire) > 0 || stopping.load(); });
+    return pending.load(std::memory_order_acquire) > 0;
+}
+
+/**
+ * @post: One item fewer is pending; another thread is woken if items are left, so that they do not wait for the
+taker.
+*/
+template<class List>
+void BasicOrderPipeline<List>::Signal::take() {
+    if (pending.fetch_sub(1, std::memory_order_acq_rel) > 1) {
+        std::lock_guard<std::mutex> lock(mutex);
+        wake.notify_one();
+    }
+}
+
+/**
+ * @post: The threads are woken to see that they should stop.
+*/
+template<class List>
+void BasicOrderPipeline<List>::Signal::interrupt() {
+    std::lock_guard<std::mutex> lock(mutex);
+    wake.notify_all();
+}
+
+/**
+ * Queues a ticket for the router.
+ * @param ticket The order, with its names resolved.
+ * @post: The ticket is queued, waiting while the queue is full.
+*/
+template<class List>
+void BasicOrderPipeline<List>::enqueue(Ticket&& ticket) {
+    while (!submissions_.tryPush(std::move(ticket))) {
+        std::this_thread::yield();  // Back-pressure: the router is behind
+    }
+    router_signal_.post();
+}
+
+/**
+ * Routes the submitted orders to the lanes, until stopped.
+*/
+template<class List>
+void BasicOrderPipeline<List>::runRouter() {
+    Ticket ticket;
+    do {
+        while (submissions_.tryPop(ticket)) {
+            router_signal_.pending.fetch_sub(1, std::memory_order_acq_rel);
+            route(std::move(ticket));
+        }
+    } while (router_signal_.wait(router_stopping_));
+}
+
+/**
+ * Picks the station of an order and hands the order to its lane.
+ * @param ticket The order.
+ * @post: The order is in its station's lane, or completed as NOT_ASSIGNED if no station was found for it. An order
+for any station that none can complete goes to a station carrying the dish, whose worker completes it as
+INSUFFICIENT_STOCK with the short ingredient, or prepares it if the stock came in meanwhile.
+*/
+template<class List>
+void BasicOrderPipeline<List>::route(Ticket&& ticket) {
+    KitchenStation* station = nullptr;
+    if (!ticket.any_station) {
+        station = manager_.findStation(ticket.station_name);
+    } else if (!(station = manager_.findStationForOrder(ticket.dish_name))) {
+        station = manager_.findStationCarrying(ticket.dish_name);  // Its worker reports what is short
+    }
+    auto lane = station ? lane_of_.find(station) : lane_of_.end();
+    if (lane == lane_of_.end()) {
+        complete(ticket, OrderResult{nullptr, {KitchenStation::PrepareResult::NOT_ASSIGNED, ""}});
+        return;
+    }
+    while (!lane->second->queue.tryPush(std::move(ticket))) {
+        std::this_thread::yield();  // Back-pressure: the station is behind
+    }
+    if (scheduling_ == PINNED) {
+        workers_[lane->second->worker]->signal.post();
+    } else if (lane->second->queued.fetch_add(1, std::memory_order_acq_rel) == 0) {
+        // The lane was idle: schedule it onto the worker it was given to, where it is stolen if that one is busy
+        Lane* scheduled = lane->second;
+        while (!workers_[scheduled->worker]->inbox.tryPush(std::move(scheduled))) {
+            std::this_thread::yield();
+        }
+        ready_.post();
+    }
+}
+
+/**
+ * Prepares the orders in a worker's lanes, until stopped.
+ * @param worker The worker.
+*/
+template<class List>
+void BasicOrderPipeline<List>::runWorker(Worker& worker) {
+    Ticket ticket;
+    do {
+        bool prepared_any = true;
+        while (prepared_any) {
+            prepared_any = false;
+            for (Lane* lane : worker.lanes) {
+                // A bounded batch per lane, so that a busy station does not starve the others of this worker
+                for (std::size_t taken = 0; taken < LANE_BATCH && lane->queue.tryPop(ticket); taken++) {
+                    worker.signal.pending.fetch_sub(1, std::memory_order_acq_rel);
+                    complete(ticket, OrderResult{lane->station, lane->station->tryPrepareDish(ticket.dish_name,
+                                                                                              ticket.count)});
+                    prepared_any = true;
+                }
+            }
+        }
+    } while (worker.signal.wait(workers_stopping_));
+}
+
+/**
+ * Prepares the orders of the lanes scheduled onto a worker or stolen from the others, until stopped.
+ * @param worker The worker.
+*/
+template<class List>
+void BasicOrderPipeline<List>::runStealingWorker(Worker& worker) {
+    Lane* lane = nullptr;
+    do {
+        while (findLane(worker, lane)) {
+            ready_.take();
+            runLane(worker, lane);
+        }
+    } while (ready_.wait(workers_stopping_));
+}
+
+/**
+ * Finds a scheduled lane for a worker: from its inbox first, then its deque, then the inboxes and deques of the
+others.
+ * @param worker The worker.
+ * @param lane Set to the lane found, which the worker now holds.
+ * @return: True if a lane was found.
+*/
+template<class List>
+bool BasicOrderPipeline<List>::findLane(Worker& worker, Lane*& lane) {
+    // The inbox before the deque, so that a busy lane taken back after each batch does not shut out new ones
+    if (worker.inbox.tryPop(lane) || worker.deque.popBottom(lane)) {
+        return true;
+    }
+    for (std::size_t i = 1; i < workers_.size(); i++) {
+        Worker& victim = *workers_[(worker.index + i) % workers_.size()];
+        if (victim.inbox.tryPop(lane) || victim.deque.steal(lane)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Prepares a batch of the orders of a scheduled lane.
+ * @param worker The worker holding the lane.
+ * @param lane The lane.
+ * @post: The lane is back on the worker's deque if orders are left in it, and no longer scheduled otherwise.
+*/
+template<class List>
+void BasicOrderPipeline<List>::runLane(Worker& worker, Lane* lane) {
+    // Only orders already counted are taken, so the count stays at or above what is left in the queue
+    const std::size_t batch = std::min(LANE_BATCH, lane->queued.load(std::memory_order_acquire));
+    Ticket ticket;
+    std::size_t taken = 0;
+    while (taken < batch && lane->queue.tryPop(ticket)) {
+        taken++;
+        complete(ticket, OrderResult{lane->station, lane->station->tryPrepareDish(ticket.dish_name, ticket.count)});
+    }
+    if (lane->queued.fetch_sub(taken, std::memory_order_acq_rel) != taken) {
+        // Orders are left, or were counted in meanwhile: the lane stays scheduled, on this worker until stolen
+        while (!worker.deque.pushBottom(lane)) {
+            std::this_thread::yield();
+        }
+        ready_.post();
+    }
+}
+
+/**
+ * Reports the outcome of an order to its callback or its future.
+ * @param ticket The order.
+ * @param outcome Its outcome.
+*/
+template<class List>
+void BasicOrderPipeline<List>::complete(Ticket& ticket, const OrderResult& outcome) {
+    if (ticket.on_done) {
+        ticket.on_done(outcome);
+        ticket.on_done = nullptr;
+    } else if (ticket.promise) {
+        ticket.promise->set_value(outcome);
+        ticket.promise.reset();
+    }
+}
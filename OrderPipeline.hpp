@@ -0,0 +1,313 @@
+/**
+ * @file OrderPipeline.hpp
+ * @brief This file contains the declaration of the OrderPipeline class, which executes orders against a station manager on worker threads in a virtual bistro simulation.
+ *
+ * Producers submit orders into one multi-producer multi-consumer queue. A router thread takes them off in order,
+ * picks the station for each, and hands it to that station's single-producer single-consumer lane. Each lane belongs
+ * to one worker thread at a time, which prepares the orders of its stations one after the other, so a station is never
+ * worked by two threads at once. Completions come back through a future or a callback.
+ *
+ * Under PINNED scheduling a lane stays with the worker it was first given to. Under WORK_STEALING a lane holding
+ * orders is scheduled as a whole onto one worker's deque; a worker that runs out of lanes of its own steals lanes
+ * from the others, so that the quiet stations sharing a worker with a busy one are not held up behind it.
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#ifndef ORDER_PIPELINE_HPP
+#define ORDER_PIPELINE_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "MpmcQueue.hpp"
+#include "SpscQueue.hpp"
+#include "StationManager.hpp"
+#include "WorkStealingDeque.hpp"
+
+/**
+ * The scheduling policies are shared by every BasicOrderPipeline, whatever list it is built on.
+ */
+class OrderScheduling {
+public:
+    /**
+     * How the lanes are shared among the workers.
+     * - PINNED: Each lane is emptied by the worker it was given to, and no other.
+     * - WORK_STEALING: A lane holding orders is taken as a whole by one worker at a time; idle workers steal lanes
+     *   waiting on busy ones.
+     */
+    enum Scheduling { PINNED, WORK_STEALING };
+};
+
+/**
+ * The pipeline is built on the station manager of the same list.
+ * @param List The station list of the manager, e.g. StationList.
+ */
+template<class List>
+class BasicOrderPipeline : public OrderScheduling {
+public:
+    /**
+    * The outcome of an order.
+    */
+    struct OrderResult {
+        KitchenStation* station; // The station that took the order; nullptr if none was found
+        KitchenStation::PrepareResult result; // NOT_ASSIGNED when no station was found
+    };
+
+    using Callback = std::function<void(const OrderResult&)>;
+
+    /**
+    * Parameterized Constructor
+    * @param manager The station manager whose stations take the orders.
+    * @param worker_count The number of worker threads (at least 1, at
+    most one per station).
+    * @param scheduling How the lanes are shared among the workers.
+    * @param queue_capacity The number of orders the submission queue
+    holds before producers have to wait.
+    * @pre: No other thread is using the manager. No station is removed
+    from it while the pipeline runs.
+    * @post: Starts the router and the workers. Each station on the
+    floor now gets a lane, assigned to the workers in list order;
+    stations added later get no orders from the pipeline. A manager in
+    SINGLE_THREADED mode is put in LOCKED mode until the pipeline stops.
+    */
+    BasicOrderPipeline(BasicStationManager<List>& manager, std::size_t worker_count,
+                       Scheduling scheduling = PINNED, std::size_t queue_capacity = 4096);
+
+    /**
+    * Destructor
+    * @post: Stops the pipeline, as stop does.
+    */
+    ~BasicOrderPipeline();
+
+    BasicOrderPipeline(const BasicOrderPipeline& other) = delete;
+    BasicOrderPipeline& operator=(const BasicOrderPipeline& other) = delete;
+
+    /**
+    * Submits an order for one serving of a dish, at any station able to
+    prepare it.
+    * @param dish_name A string representing the name of the dish.
+    * @post: The order is queued, waiting while the queue is full.
+    * @return: A future for its outcome. The station is picked when the
+    order is routed, among those able to complete it at that point.
+    */
+    std::future<OrderResult> submit(const std::string& dish_name);
+
+    /**
+    * Submits an order for servings of a dish.
+    * @param station_name A string representing the station's name; an
+    empty name lets the router pick any station able to prepare it.
+    * @param dish_name A string representing the name of the dish.
+    * @param count The number of servings to prepare, all or none.
+    * @post: The order is queued, waiting while the queue is full.
+    * @return: A future for its outcome.
+    */
+    std::future<OrderResult> submit(const std::string& station_name, const std::string& dish_name, int count = 1);
+
+    /**
+    * Submits an order for servings of a dish, to be reported through a
+    callback.
+    * @param station_name A string representing the station's name; an
+    empty name lets the router pick any station able to prepare it.
+    * @param dish_name A string representing the name of the dish.
+    * @param count The number of servings to prepare, all or none.
+    * @param on_done Called once with the outcome, on the worker that
+    prepared the order (or on this thread if the names are unknown). It
+    must not throw.
+    * @post: The order is queued, waiting while the queue is full.
+    */
+    void submit(const std::string& station_name, const std::string& dish_name, int count, Callback on_done);
+
+    /**
+    * Stops the pipeline once every order submitted so far is done.
+    * @pre: No thread is submitting orders, now or later. If the
+    pipeline put the manager in LOCKED mode, no other thread is using
+    the manager either.
+    * @post: The router and the workers have finished, and the manager
+    is back in the concurrency mode it had before the pipeline started.
+    Calling stop again does nothing.
+    */
+    void stop();
+
+    /**
+    * @return: The number of worker threads.
+    */
+    std::size_t getWorkerCount() const;
+
+    /**
+    * @return: How the lanes are shared among the workers.
+    */
+    Scheduling getScheduling() const;
+
+private:
+    /**
+    * An order on its way through the pipeline.
+    */
+    struct Ticket {
+        Symbol station_name; // Ignored for any_station orders
+        Symbol dish_name;
+        int count = 1;
+        bool any_station = false;
+        Callback on_done; // Empty when the outcome goes to the promise
+        std::optional<std::promise<OrderResult>> promise;
+    };
+
+    /**
+    * A count of the items waiting for a thread, which the thread sleeps
+    on while it is zero. Several threads may sleep on the same count.
+    */
+    struct Signal {
+        std::atomic<long> pending{0}; // Signed: a consumer may count an item down before its producer counts it up
+        std::mutex mutex;
+        std::condition_variable wake;
+
+        /**
+        * @post: One more item is pending; the thread is woken if it may
+        be sleeping.
+        */
+        void post();
+
+        /**
+        * Waits until an item is pending or the thread is told to stop.
+        * @param stopping Set when the thread should stop once idle.
+        * @return: True if an item is pending; false if the thread should
+        stop.
+        */
+        bool wait(const std::atomic<bool>& stopping);
+
+        /**
+        * @post: One item fewer is pending; another thread is woken if
+        items are left, so that they do not wait for the taker.
+        */
+        void take();
+
+        /**
+        * @post: The threads are woken to see that they should stop.
+        */
+        void interrupt();
+    };
+
+    /**
+    * The orders routed to one station.
+    */
+    struct Lane {
+        KitchenStation* station;
+        std::size_t worker; // Index of the worker it is given to first
+        SpscQueue<Ticket> queue; // Filled by the router, emptied by one worker at a time
+        // WORK_STEALING: the orders counted into the queue; the lane is scheduled while this is above zero
+        std::atomic<std::size_t> queued{0};
+
+        Lane(KitchenStation* owner, std::size_t worker_index) : station(owner), worker(worker_index),
+                                                                queue(LANE_CAPACITY) {}
+    };
+
+    /**
+    * A worker thread and the lanes it empties.
+    */
+    struct Worker {
+        std::vector<Lane*> lanes; // PINNED: the lanes it is given
+        Signal signal; // PINNED: counts the orders waiting in its lanes
+        // WORK_STEALING: the lanes the router scheduled onto it, and those it took back after a batch. Each lane is
+        // in at most one of these at a time, so neither fills up.
+        MpmcQueue<Lane*> inbox;
+        WorkStealingDeque<Lane*> deque;
+        std::size_t index; // In workers_
+        std::thread thread;
+
+        Worker(std::size_t worker_index, std::size_t lane_count) : inbox(lane_count), deque(lane_count),
+                                                                   index(worker_index) {}
+    };
+
+    static constexpr std::size_t LANE_CAPACITY = 256; // Orders a station's lane holds before the router waits
+    static constexpr std::size_t LANE_BATCH = 32; // Orders a worker takes from a lane before it turns to the next
+
+    /**
+    * Queues a ticket for the router.
+    * @param ticket The order, with its names resolved.
+    * @post: The ticket is queued, waiting while the queue is full.
+    */
+    void enqueue(Ticket&& ticket);
+
+    /**
+    * Routes the submitted orders to the lanes, until stopped.
+    */
+    void runRouter();
+
+    /**
+    * Picks the station of an order and hands the order to its lane.
+    * @param ticket The order.
+    * @post: The order is in its station's lane, or completed as
+    NOT_ASSIGNED if no station was found for it. An order for any
+    station that none can complete goes to a station carrying the dish,
+    whose worker completes it as INSUFFICIENT_STOCK with the short
+    ingredient, or prepares it if the stock came in meanwhile.
+    */
+    void route(Ticket&& ticket);
+
+    /**
+    * Prepares the orders in a worker's lanes, until stopped.
+    * @param worker The worker.
+    */
+    void runWorker(Worker& worker);
+
+    /**
+    * Prepares the orders of the lanes scheduled onto a worker or stolen
+    from the others, until stopped.
+    * @param worker The worker.
+    */
+    void runStealingWorker(Worker& worker);
+
+    /**
+    * Finds a scheduled lane for a worker: from its inbox first, then its
+    deque, then the inboxes and deques of the others.
+    * @param worker The worker.
+    * @param lane Set to the lane found, which the worker now holds.
+    * @return: True if a lane was found.
+    */
+    bool findLane(Worker& worker, Lane*& lane);
+
+    /**
+    * Prepares a batch of the orders of a scheduled lane.
+    * @param worker The worker holding the lane.
+    * @param lane The lane.
+    * @post: The lane is back on the worker's deque if orders are left in
+    it, and no longer scheduled otherwise.
+    */
+    void runLane(Worker& worker, Lane* lane);
+
+    /**
+    * Reports the outcome of an order to its callback or its future.
+    * @param ticket The order.
+    * @param outcome Its outcome.
+    */
+    static void complete(Ticket& ticket, const OrderResult& outcome);
+
+    BasicStationManager<List>& manager_;
+    MpmcQueue<Ticket> submissions_; // Filled by the producers, emptied by the router
+    std::vector<std::unique_ptr<Lane>> lanes_;
+    std::unordered_map<const KitchenStation*, Lane*> lane_of_; // Built once, then only read by the router
+    std::vector<std::unique_ptr<Worker>> workers_;
+    Scheduling scheduling_;
+    Signal router_signal_; // Counts the orders waiting in submissions_
+    Signal ready_; // WORK_STEALING: counts the lanes waiting in the inboxes and deques
+    std::atomic<bool> router_stopping_;
+    std::atomic<bool> workers_stopping_;
+    std::thread router_;
+    bool stopped_;
+    KitchenStation::ConcurrencyMode previous_mode_; // The manager's mode before the pipeline, restored by stop
+};
+
+using OrderPipeline = BasicOrderPipeline<StationList>;
+
+#include "OrderPipeline.cpp"
+#endif // ORDER_PIPELINE_HPP
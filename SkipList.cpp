@@ -0,0 +1,501 @@
+/** ADT list: indexable skip list implementation.
+
+ Implementation file for the class SkipList.
+ @file SkipList.cpp */
+
+#include "SkipList.hpp"  // Header file
+#include <algorithm>
+#include <new>
+#include <string>
+#include <utility>
+
+// constructor
+template<class T>
+SkipList<T>::SkipList() : level_(1), item_count_(0)
+{
+   head_[0] = Link{nullptr, 1};
+}  // end default constructor
+
+
+// copy constructor
+template<class T>
+SkipList<T>::SkipList(const SkipList<T>& a_list) : level_(1), item_count_(0),
+      height_engine_(a_list.height_engine_)
+{
+   head_[0] = Link{nullptr, 1};
+   for (const T& entry : a_list)
+      pushBack(entry);
+}  // end copy constructor
+
+
+// move constructor: takes over the chain of a_list, which is left empty
+template<class T>
+SkipList<T>::SkipList(SkipList<T>&& a_list) noexcept : level_(1), item_count_(0)
+{
+   head_[0] = Link{nullptr, 1};
+   *this = std::move(a_list);
+}  // end move constructor
+
+
+// copy assignment
+template<class T>
+SkipList<T>& SkipList<T>::operator=(const SkipList<T>& a_list)
+{
+   if (this != &a_list)
+      *this = SkipList<T>(a_list);
+   return *this;
+}  // end copy assignment
+
+
+// move assignment: releases the current chain and takes over the chain of a_list
+template<class T>
+SkipList<T>& SkipList<T>::operator=(SkipList<T>&& a_list) noexcept
+{
+   if (this != &a_list)
+   {
+      clear();
+      for (int i = 0; i < a_list.level_; i++)
+         head_[i] = a_list.head_[i];
+      level_ = std::exchange(a_list.level_, 1);
+      item_count_ = std::exchange(a_list.item_count_, 0);
+      height_engine_ = a_list.height_engine_;
+      a_list.head_[0] = Link{nullptr, 1};
+   }
+   return *this;
+}  // end move assignment
+
+
+// destructor
+template<class T>
+SkipList<T>::~SkipList()
+{
+   clear();
+}  // end destructor
+
+
+
+/**@return true if list is empty - item_count_ == 0 */
+template<class T>
+bool SkipList<T>::isEmpty() const
+{
+   return item_count_ == 0;
+}  // end isEmpty
+
+
+/**@return the number of items in the list - item_count_ */
+template<class T>
+int SkipList<T>::getLength() const
+{
+   return item_count_;
+}  // end getLength
+
+
+/**
+ @pre list positions follow traditional indexing from 0 to item_count_ -1
+ @param position indicating point of insertion
+ @param new_entry to be inserted in list
+ @post new_entry is added at position in list (the entry previously at that position is now at position+1),
+       in O(log n) expected time
+ @return true if valid position (0 <= position <= item_count_) */
+template<class T>
+bool SkipList<T>::insert(int position, const T& new_entry)
+{
+   return emplace(position, new_entry);
+}  // end insert
+
+
+template<class T>
+bool SkipList<T>::insert(int position, T&& new_entry)
+{
+   return emplace(position, std::move(new_entry));
+}  // end insert
+
+
+/**
+ @pre list positions follow traditional indexing from 0 to item_count_ -1
+ @param position indicating point of insertion
+ @param args forwarded to the constructor of T
+ @post an entry constructed in place from args is added at position in list
+ @return true if valid position (0 <= position <= item_count_) */
+template<class T>
+template<class... Args>
+bool SkipList<T>::emplace(int position, Args&&... args)
+{
+   bool ableToInsert = (position >= 0) && (position <= item_count_);
+   if (ableToInsert)
+      link(createNode(std::forward<Args>(args)...), position);
+   return ableToInsert;
+}  // end emplace
+
+
+/**
+ @param new_entry to be inserted in list
+ @post new_entry is added at the end of the list, in O(log n) expected time */
+template<class T>
+void SkipList<T>::pushBack(const T& new_entry)
+{
+   link(createNode(new_entry), item_count_);
+}  // end pushBack
+
+
+template<class T>
+void SkipList<T>::pushBack(T&& new_entry)
+{
+   link(createNode(std::move(new_entry)), item_count_);
+}  // end pushBack
+
+
+/**
+ @param new_entry to be inserted in list
+ @post new_entry is added at the beginning of the list, in O(log n) expected time */
+template<class T>
+void SkipList<T>::pushFront(const T& new_entry)
+{
+   link(createNode(new_entry), 0);
+}  // end pushFront
+
+
+template<class T>
+void SkipList<T>::pushFront(T&& new_entry)
+{
+   link(createNode(std::move(new_entry)), 0);
+}  // end pushFront
+
+
+/**
+ @pre list positions follow traditional indexing from 0 to item_count_ -1
+ @param position indicating point of deletion
+ @post entry at position is deleted, if any, in O(log n) expected time. List order is retained
+ @return true if there is an entry at position to be deleted, false otherwise */
+template<class T>
+bool SkipList<T>::remove(int position)
+{
+   bool ableToRemove = (position >= 0) && (position < item_count_);
+   if (ableToRemove)
+      destroyNode(unlink(position));
+   return ableToRemove;
+}  // end remove
+
+
+/**@post the list is empty and item_count_ == 0*/
+template<class T>
+void SkipList<T>::clear()
+{
+   SkipNode* node_ptr = head_[0].next_;
+   while (node_ptr != nullptr)
+   {
+      SkipNode* next_ptr = node_ptr->getNext();
+      destroyNode(node_ptr);
+      node_ptr = next_ptr;
+   }
+   level_ = 1;
+   item_count_ = 0;
+   head_[0] = Link{nullptr, 1};
+}  // end clear
+
+
+/**
+ @pre list positions follow traditional indexing from 0 to item_count_ -1
+ @param position indicating the position of the data to be retrieved
+ @return reference to the data item found at position, in O(log n) expected time.
+        If position is not a valid position < item_count_ throws  PrecondViolatedExcep */
+template<class T>
+const T& SkipList<T>::getEntry(int position) const
+{
+   // Enforce precondition
+   bool ableToGet = (position >= 0) && (position < item_count_);
+   if (ableToGet)
+   {
+      return getPointerTo(position)->getItem();
+   }
+   else
+   {
+      std::string message = "getEntry() called with an empty list or ";
+      message  = message + "invalid position.";
+      throw(PrecondViolatedExcep(message));
+   }  // end if
+}  // end getEntry
+
+
+// descends from the top level, following every link that does not overshoot position
+template<class T>
+typename SkipList<T>::SkipNode* SkipList<T>::getPointerTo(std::size_t position) const
+{
+   if (position >= static_cast<std::size_t>(item_count_))
+      return nullptr;
+
+   const int target = static_cast<int>(position);
+   const SkipNode* cur_ptr = nullptr; // the head
+   int cur_position = -1;
+   for (int i = level_ - 1; i >= 0; i--)
+   {
+      const Link* links = linksOf(cur_ptr);
+      while (links[i].next_ != nullptr && cur_position + links[i].width_ <= target)
+      {
+         cur_position += links[i].width_;
+         cur_ptr = links[i].next_;
+         links = linksOf(cur_ptr);
+      }
+   }
+   return const_cast<SkipNode*>(cur_ptr);
+}  // end getPointerTo
+
+
+//returns the first node of the chain, nullptr if the list is empty
+template<class T>
+typename SkipList<T>::SkipNode* SkipList<T>::getHeadNode() const
+{
+   return head_[0].next_;
+}  // end getHeadNode
+
+
+/**@return iterator to the first entry, equal to end() if the list is empty */
+template<class T>
+typename SkipList<T>::iterator SkipList<T>::begin()
+{
+   return iterator(head_[0].next_, 0);
+}  // end begin
+
+
+template<class T>
+typename SkipList<T>::const_iterator SkipList<T>::begin() const
+{
+   return const_iterator(head_[0].next_, 0);
+}  // end begin
+
+
+template<class T>
+typename SkipList<T>::const_iterator SkipList<T>::cbegin() const
+{
+   return begin();
+}  // end cbegin
+
+
+/**@return iterator one past the last entry */
+template<class T>
+typename SkipList<T>::iterator SkipList<T>::end()
+{
+   return iterator(nullptr, item_count_);
+}  // end end
+
+
+template<class T>
+typename SkipList<T>::const_iterator SkipList<T>::end() const
+{
+   return const_iterator(nullptr, item_count_);
+}  // end end
+
+
+template<class T>
+typename SkipList<T>::const_iterator SkipList<T>::cend() const
+{
+   return end();
+}  // end cend
+
+
+/**
+ @param entry to be searched for
+ @return iterator to the first entry equal to entry, end() if there is none. Linear time */
+template<class T>
+typename SkipList<T>::iterator SkipList<T>::find(const T& entry)
+{
+   return std::find(begin(), end(), entry);
+}  // end find
+
+
+template<class T>
+typename SkipList<T>::const_iterator SkipList<T>::find(const T& entry) const
+{
+   return std::find(begin(), end(), entry);
+}  // end find
+
+
+/**
+ @pre position refers to an entry of this list (it is not end())
+ @param position iterator to the entry to be deleted
+ @post the entry is deleted in O(log n) expected time. Iterators to later
+       entries are invalidated
+ @return iterator to the entry that followed the deleted one */
+template<class T>
+typename SkipList<T>::iterator SkipList<T>::erase(iterator position)
+{
+   SkipNode* next_ptr = position.node_->getNext();
+   destroyNode(unlink(position.position_));
+   return iterator(next_ptr, position.position_);
+}  // end erase
+
+
+/**
+ @pre position refers to an entry of this list (it is not end())
+ @param position iterator to the entry to be moved
+ @post the node of that entry is relinked at the head of the list, in O(log n)
+       expected time and without allocating. Other iterators are invalidated
+ @return iterator to the moved entry, now equal to begin() */
+template<class T>
+typename SkipList<T>::iterator SkipList<T>::moveToFront(iterator position)
+{
+   if (position.position_ != 0)
+      link(unlink(position.position_), 0);
+   return begin();
+}  // end moveToFront
+
+
+/**
+ @pre position and source refer to entries of this list (neither is end())
+ @param position iterator to the entry after which to relink
+ @param source iterator to the entry to be moved
+ @post the node of source is relinked right after position, in O(log n)
+       expected time and without allocating. Other iterators are invalidated
+ @return iterator to the moved entry */
+template<class T>
+typename SkipList<T>::iterator SkipList<T>::spliceAfter(iterator position, iterator source)
+{
+   if (position.node_ == source.node_ || position.node_->getNext() == source.node_)
+      return source;
+
+   // once source is detached, entries after it move up by one
+   int target = position.position_ < source.position_ ? position.position_ + 1 : position.position_;
+   link(unlink(source.position_), target);
+   return iterator(source.node_, target);
+}  // end spliceAfter
+
+
+// @return a height from 1 to MAX_LEVEL, each level kept with probability 1/2
+template<class T>
+int SkipList<T>::randomHeight()
+{
+   int height = 1;
+   auto bits = height_engine_();
+   while (height < MAX_LEVEL && (bits & 1) != 0)
+   {
+      height++;
+      bits >>= 1;
+   }
+   return height;
+}  // end randomHeight
+
+
+// @return the links leaving the node, or the head links for nullptr
+template<class T>
+typename SkipList<T>::Link* SkipList<T>::linksOf(SkipNode* node_ptr)
+{
+   return node_ptr == nullptr ? head_ : node_ptr->links_;
+}  // end linksOf
+
+
+template<class T>
+const typename SkipList<T>::Link* SkipList<T>::linksOf(const SkipNode* node_ptr) const
+{
+   return node_ptr == nullptr ? head_ : node_ptr->links_;
+}  // end linksOf
+
+
+// Records, for every level in use, the last node before position and that node's position.
+template<class T>
+void SkipList<T>::findPredecessors(int position, SkipNode* update[], int update_position[]) const
+{
+   const SkipNode* cur_ptr = nullptr; // the head
+   int cur_position = -1;
+   for (int i = level_ - 1; i >= 0; i--)
+   {
+      const Link* links = linksOf(cur_ptr);
+      while (links[i].next_ != nullptr && cur_position + links[i].width_ < position)
+      {
+         cur_position += links[i].width_;
+         cur_ptr = links[i].next_;
+         links = linksOf(cur_ptr);
+      }
+      update[i] = const_cast<SkipNode*>(cur_ptr);
+      update_position[i] = cur_position;
+   }
+}  // end findPredecessors
+
+
+// Links a detached node into the chain so that it ends up at position.
+template<class T>
+void SkipList<T>::link(SkipNode* node_ptr, int position)
+{
+   const int height = node_ptr->height_;
+   for (; level_ < height; level_++)
+      head_[level_] = Link{nullptr, item_count_ + 1}; // the head spans the whole list
+
+   SkipNode* update[MAX_LEVEL];
+   int update_position[MAX_LEVEL];
+   findPredecessors(position, update, update_position);
+
+   for (int i = 0; i < level_; i++)
+   {
+      Link& before = linksOf(update[i])[i];
+      if (i < height)
+      {
+         // split the link that jumped over position in two
+         node_ptr->links_[i] = Link{before.next_, update_position[i] + before.width_ + 1 - position};
+         before = Link{node_ptr, position - update_position[i]};
+      }
+      else
+      {
+         before.width_++;
+      }
+   }
+   item_count_++;
+}  // end link
+
+
+// Detaches the node at position from the chain without destroying it.
+template<class T>
+typename SkipList<T>::SkipNode* SkipList<T>::unlink(int position)
+{
+   SkipNode* update[MAX_LEVEL];
+   int update_position[MAX_LEVEL];
+   findPredecessors(position, update, update_position);
+
+   SkipNode* node_ptr = linksOf(update[0])[0].next_;
+   for (int i = 0; i < level_; i++)
+   {
+      Link& before = linksOf(update[i])[i];
+      if (before.next_ == node_ptr)
+      {
+         // join the links on either side of the node
+         before.next_ = node_ptr->links_[i].next_;
+         before.width_ += node_ptr->links_[i].width_ - 1;
+      }
+      else
+      {
+         before.width_--;
+      }
+   }
+   item_count_--;
+
+   while (level_ > 1 && head_[level_ - 1].next_ == nullptr)
+      level_--;
+   return node_ptr;
+}  // end unlink
+
+
+// @return a new detached node of random height holding an entry built from args
+template<class T>
+template<class... Args>
+typename SkipList<T>::SkipNode* SkipList<T>::createNode(Args&&... args)
+{
+   const int height = randomHeight();
+   void* raw = ::operator new(sizeof(SkipNode) + height * sizeof(Link));
+   Link* links = reinterpret_cast<Link*>(static_cast<unsigned char*>(raw) + sizeof(SkipNode));
+   try
+   {
+      return new (raw) SkipNode(height, links, std::forward<Args>(args)...);
+   }
+   catch (...)
+   {
+      ::operator delete(raw);
+      throw;
+   }
+}  // end createNode
+
+
+// @post the node and its links are returned to the system
+template<class T>
+void SkipList<T>::destroyNode(SkipNode* node_ptr)
+{
+   node_ptr->~SkipNode();
+   ::operator delete(static_cast<void*>(node_ptr));
+}  // end destroyNode
@@ -0,0 +1,263 @@
+/** ADT list: indexable skip list implementation.
+    Every link records its width, the number of entries it jumps over, so a
+    position is reached by descending the levels in O(log n) expected time.
+    The interface mirrors LinkedList, so the two can be swapped at compile time.
+    @file SkipList.hpp */
+
+#ifndef SKIP_LIST_
+#define SKIP_LIST_
+
+#include <cstddef>
+#include <iterator>
+#include <random>
+#include <type_traits>
+#include "PrecondViolatedExcep.hpp"
+
+template<class T>
+class SkipList
+{
+public:
+   static constexpr int MAX_LEVEL = 32;
+
+   class SkipNode;
+
+   /** A forward link of a node at one level */
+   struct Link
+   {
+      SkipNode* next_;    // next node at this level, nullptr past the last one
+      int width_;         // positions advanced by following the link (to the end of the list for nullptr)
+   };
+
+   /** A node of the chain: an entry and one link per level of its tower */
+   class SkipNode
+   {
+   public:
+      /**@return the entry held by the node */
+      T& getItem() { return item_; }
+      const T& getItem() const { return item_; }
+
+      /**@return the node after this one, nullptr for the last one */
+      SkipNode* getNext() const { return links_[0].next_; }
+
+      /**@return the number of levels the node takes part in */
+      int getHeight() const { return height_; }
+
+   private:
+      friend class SkipList<T>;
+
+      template<class... Args>
+      SkipNode(int height, Link* links, Args&&... args) :
+            item_(std::forward<Args>(args)...), height_(height), links_(links) {}
+
+      T item_;
+      int height_;
+      Link* links_; // height_ links, stored right after the node
+   }; // end SkipNode
+
+   /** Forward iterator over the entries of the list.
+       It remembers the position of its entry so that erase(it) can find the
+       links to update with a single descent.
+       @param IsConst true for const_iterator, false for iterator */
+   template<bool IsConst>
+   class ListIterator
+   {
+   public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = T;
+      using difference_type = std::ptrdiff_t;
+      using pointer = std::conditional_t<IsConst, const T*, T*>;
+      using reference = std::conditional_t<IsConst, const T&, T&>;
+
+      ListIterator() : node_(nullptr), position_(0) {}
+
+      // an iterator converts to a const_iterator, never the other way around
+      template<bool WasConst, class = std::enable_if_t<IsConst && !WasConst>>
+      ListIterator(const ListIterator<WasConst>& other) :
+            node_(other.node_), position_(other.position_) {}
+
+      reference operator*() const { return node_->getItem(); }
+      pointer operator->() const { return &node_->getItem(); }
+
+      ListIterator& operator++()
+      {
+         node_ = node_->getNext();
+         position_++;
+         return *this;
+      }
+
+      ListIterator operator++(int)
+      {
+         ListIterator old = *this;
+         ++(*this);
+         return old;
+      }
+
+      friend bool operator==(const ListIterator& lhs, const ListIterator& rhs)
+      {
+         return lhs.node_ == rhs.node_;
+      }
+
+      friend bool operator!=(const ListIterator& lhs, const ListIterator& rhs)
+      {
+         return lhs.node_ != rhs.node_;
+      }
+
+   private:
+      friend class SkipList<T>;
+      template<bool> friend class ListIterator;
+
+      ListIterator(SkipNode* node, int position) : node_(node), position_(position) {}
+
+      SkipNode* node_; // current node, nullptr past the end
+      int position_;   // position of node_ in the list
+   }; // end ListIterator
+
+   using iterator = ListIterator<false>;
+   using const_iterator = ListIterator<true>;
+
+   SkipList(); // constructor
+   SkipList(const SkipList<T>& a_list); // copy constructor
+   SkipList(SkipList<T>&& a_list) noexcept; // move constructor, a_list is left empty
+   SkipList<T>& operator=(const SkipList<T>& a_list); // copy assignment
+   SkipList<T>& operator=(SkipList<T>&& a_list) noexcept; // move assignment, a_list is left empty
+   virtual ~SkipList(); // destructor
+
+   /**@return true if list is empty - item_count_ == 0 */
+   bool isEmpty() const;
+
+   /**@return the number of items in the list - item_count_ */
+   int getLength() const;
+
+    /**
+     @pre list positions follow traditional indexing from 0 to item_count_ -1
+     @param position indicating point of insertion
+     @param new_entry to be inserted in list
+     @post new_entry is added at position in list (the entry previously at that position is now at position+1),
+           in O(log n) expected time
+     @return true if valid position (0 <= position <= item_count_) */
+   bool insert(int position, const T& new_entry);
+   bool insert(int position, T&& new_entry);
+
+    /**
+     @pre list positions follow traditional indexing from 0 to item_count_ -1
+     @param position indicating point of insertion
+     @param args forwarded to the constructor of T
+     @post an entry constructed in place from args is added at position in list
+     @return true if valid position (0 <= position <= item_count_) */
+   template<class... Args>
+   bool emplace(int position, Args&&... args);
+
+    /**
+     @param new_entry to be inserted in list
+     @post new_entry is added at the end of the list, in O(log n) expected time */
+   void pushBack(const T& new_entry);
+   void pushBack(T&& new_entry);
+
+    /**
+     @param new_entry to be inserted in list
+     @post new_entry is added at the beginning of the list, in O(log n) expected time */
+   void pushFront(const T& new_entry);
+   void pushFront(T&& new_entry);
+
+    /**
+     @pre list positions follow traditional indexing from 0 to item_count_ -1
+     @param position indicating point of deletion
+     @post entry at position is deleted, if any, in O(log n) expected time. List order is retained
+     @return true if there is an entry at position to be deleted, false otherwise */
+   bool remove(int position);
+
+   /**@post the list is empty and item_count_ == 0*/
+   void clear();
+
+    /**
+     @pre list positions follow traditional indexing from 0 to item_count_ -1
+     @param position indicating the position of the data to be retrieved
+     @return reference to the data item found at position, in O(log n) expected time.
+            If position is not a valid position < item_count_ throws  PrecondViolatedExcep */
+   const T& getEntry(int position) const;
+
+   //if position >= item_count_ returns nullptr
+   SkipNode* getPointerTo(std::size_t position) const;
+
+   //returns the first node of the chain, nullptr if the list is empty
+   SkipNode* getHeadNode() const;
+
+   /**@return iterator to the first entry, equal to end() if the list is empty */
+   iterator begin();
+   const_iterator begin() const;
+   const_iterator cbegin() const;
+
+   /**@return iterator one past the last entry */
+   iterator end();
+   const_iterator end() const;
+   const_iterator cend() const;
+
+    /**
+     @param entry to be searched for
+     @return iterator to the first entry equal to entry, end() if there is none. Linear time */
+   iterator find(const T& entry);
+   const_iterator find(const T& entry) const;
+
+    /**
+     @pre position refers to an entry of this list (it is not end())
+     @param position iterator to the entry to be deleted
+     @post the entry is deleted in O(log n) expected time. Iterators to later
+           entries are invalidated
+     @return iterator to the entry that followed the deleted one */
+   iterator erase(iterator position);
+
+    /**
+     @pre position refers to an entry of this list (it is not end())
+     @param position iterator to the entry to be moved
+     @post the node of that entry is relinked at the head of the list, in O(log n)
+           expected time and without allocating. Other iterators are invalidated
+     @return iterator to the moved entry, now equal to begin() */
+   iterator moveToFront(iterator position);
+
+    /**
+     @pre position and source refer to entries of this list (neither is end())
+     @param position iterator to the entry after which to relink
+     @param source iterator to the entry to be moved
+     @post the node of source is relinked right after position, in O(log n)
+           expected time and without allocating. Other iterators are invalidated
+     @return iterator to the moved entry */
+   iterator spliceAfter(iterator position, iterator source);
+
+private:
+   Link head_[MAX_LEVEL]; // Links leaving the head, before position 0
+   int level_;            // Number of levels in use
+   int item_count_;       // Current count of list items
+   std::minstd_rand height_engine_; // Draws the height of new nodes
+
+   // @return a height from 1 to MAX_LEVEL, each level kept with probability 1/2
+   int randomHeight();
+
+   // @return the links leaving the node, or the head links for nullptr
+   Link* linksOf(SkipNode* node_ptr);
+   const Link* linksOf(const SkipNode* node_ptr) const;
+
+   // Records, for every level in use, the last node before position and that node's position.
+   // @param position the index of the first entry not to pass, 0 <= position <= item_count_
+   // @param update set to the last node (nullptr for the head) before position at each level
+   // @param update_position set to the position of that node (-1 for the head)
+   void findPredecessors(int position, SkipNode* update[], int update_position[]) const;
+
+   // Links a detached node into the chain so that it ends up at position.
+   // @pre 0 <= position <= item_count_
+   void link(SkipNode* node_ptr, int position);
+
+   // Detaches the node at position from the chain without destroying it.
+   // @pre 0 <= position < item_count_
+   // @return the detached node
+   SkipNode* unlink(int position);
+
+   // @return a new detached node of random height holding an entry built from args
+   template<class... Args>
+   SkipNode* createNode(Args&&... args);
+
+   // @post the node and its links are returned to the system
+   void destroyNode(SkipNode* node_ptr);
+}; // end SkipList
+
+#include "SkipList.cpp"
+#endif
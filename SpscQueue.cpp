@@ -0,0 +1,94 @@
+/** ADT queue: bounded single-producer single-consumer implementation.
+
+ Implementation file for the class SpscQueue.
+ @file SpscQueue.cpp */
+
+#include "SpscQueue.hpp"  // Header file
+#include <new>
+#include <utility>
+
+// constructor
+template<class T>
+SpscQueue<T>::SpscQueue(std::size_t capacity) : head_(0), cached_tail_(0), tail_(0), cached_head_(0)
+{
+   std::size_t slot_count = 2;
+   while (slot_count < capacity)
+   {
+      slot_count *= 2;
+   }
+   slots_.reset(new Slot[slot_count]);
+   mask_ = slot_count - 1;
+}  // end constructor
+
+
+// destructor
+template<class T>
+SpscQueue<T>::~SpscQueue()
+{
+   T entry;
+   while (tryPop(entry))
+   {
+   }
+}  // end destructor
+
+
+/** To be called from one thread only, the producer.
+ @param new_entry to be added at the back of the queue
+ @post new_entry is moved into the queue, unless it is full
+ @return true if the entry was added, false if the queue was full (new_entry is unchanged) */
+template<class T>
+bool SpscQueue<T>::tryPush(T&& new_entry)
+{
+   const std::size_t tail = tail_.load(std::memory_order_relaxed);
+   if (tail - cached_head_ > mask_)
+   {
+      cached_head_ = head_.load(std::memory_order_acquire);  // The copy says full: see how far the consumer got
+      if (tail - cached_head_ > mask_)
+      {
+         return false;
+      }
+   }
+   ::new (static_cast<void*>(&slots_[tail & mask_])) T(std::move(new_entry));
+   tail_.store(tail + 1, std::memory_order_release);  // Publishes the entry
+   return true;
+}  // end tryPush
+
+
+/** To be called from one thread only, the consumer.
+ @param entry set to the entry at the front of the queue, if any
+ @post the entry is removed from the queue
+ @return true if an entry was removed, false if the queue was empty */
+template<class T>
+bool SpscQueue<T>::tryPop(T& entry)
+{
+   const std::size_t head = head_.load(std::memory_order_relaxed);
+   if (head == cached_tail_)
+   {
+      cached_tail_ = tail_.load(std::memory_order_acquire);  // The copy says empty: see how far the producer got
+      if (head == cached_tail_)
+      {
+         return false;
+      }
+   }
+   T* stored = reinterpret_cast<T*>(&slots_[head & mask_]);
+   entry = std::move(*stored);
+   stored->~T();
+   head_.store(head + 1, std::memory_order_release);  // Frees the slot for the producer
+   return true;
+}  // end tryPop
+
+
+/**@return true if the queue looked empty: exact on the consumer's thread when nothing is being pushed */
+template<class T>
+bool SpscQueue<T>::isEmpty() const
+{
+   return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+}  // end isEmpty
+
+
+/**@return the number of entries the queue holds at most */
+template<class T>
+std::size_t SpscQueue<T>::capacity() const
+{
+   return mask_ + 1;
+}  // end capacity
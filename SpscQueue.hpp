@@ -0,0 +1,61 @@
+/** ADT queue: bounded single-producer single-consumer implementation.
+    A ring of slots between two counters: the producer alone advances the tail
+    and the consumer alone advances the head, so neither needs a
+    compare-and-swap, only a release store of its own counter. Each side keeps
+    a copy of the other side's counter and rereads it only when the copy says
+    the ring is full (or empty).
+    @file SpscQueue.hpp */
+
+#ifndef SPSC_QUEUE_
+#define SPSC_QUEUE_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+/** @param T type of the entries, which must be default constructible and movable */
+template<class T>
+class SpscQueue
+{
+public:
+   /** @param capacity the number of entries the queue holds at most, rounded up to a power of two (at least 2)
+       @post the queue is empty; all its slots are allocated up front */
+   explicit SpscQueue(std::size_t capacity);
+   SpscQueue(const SpscQueue& other) = delete;
+   SpscQueue& operator=(const SpscQueue& other) = delete;
+   ~SpscQueue(); // destroys the entries still queued
+
+   /** To be called from one thread only, the producer.
+       @param new_entry to be added at the back of the queue
+       @post new_entry is moved into the queue, unless it is full
+       @return true if the entry was added, false if the queue was full (new_entry is unchanged) */
+   bool tryPush(T&& new_entry);
+
+   /** To be called from one thread only, the consumer.
+       @param entry set to the entry at the front of the queue, if any
+       @post the entry is removed from the queue
+       @return true if an entry was removed, false if the queue was empty */
+   bool tryPop(T& entry);
+
+   /**@return true if the queue looked empty: exact on the consumer's thread when nothing is being pushed */
+   bool isEmpty() const;
+
+   /**@return the number of entries the queue holds at most */
+   std::size_t capacity() const;
+
+private:
+   using Slot = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+   static constexpr std::size_t CACHE_LINE = 64;
+
+   std::unique_ptr<Slot[]> slots_;
+   std::size_t mask_; // capacity - 1
+   alignas(CACHE_LINE) std::atomic<std::size_t> head_; // next entry to pop, advanced by the consumer
+   std::size_t cached_tail_;                           // the consumer's copy of tail_
+   alignas(CACHE_LINE) std::atomic<std::size_t> tail_; // next slot to fill, advanced by the producer
+   std::size_t cached_head_;                           // the producer's copy of head_
+}; // end SpscQueue
+
+#include "SpscQueue.cpp"
+#endif
@@ -10,29 +10,212 @@
 */
 
 #include "StationManager.hpp"
+#include <algorithm>  // For std::find, std::find_if, std::any_of, std::copy_if
+#include <atomic>     // For the search cancellation flag
+#include <iterator>   // For std::back_inserter
+#include <thread>     // For std::thread::hardware_concurrency
 
 /**
  * Default Constructor
  * @post: Initializes an empty station manager.
 */
-StationManager::StationManager() : LinkedList<KitchenStation*>() {}
+template<class List>
+BasicStationManager<List>::BasicStationManager()
+    : List(), listener_token_(std::make_shared<BasicStationManager*>(this)), access_policy_(NONE),
+      parallel_search_threshold_(std::thread::hardware_concurrency() > 1 ? DEFAULT_PARALLEL_SEARCH : SERIAL_SEARCH),
+      floor_changes_(0),
+      concurrency_mode_(KitchenStation::SINGLE_THREADED) {}
 
 /**
  * Destructor
  * @post: Deallocates all kitchen stations and clears the list.
 */
-StationManager::~StationManager() {
+template<class List>
+BasicStationManager<List>::~BasicStationManager() {
     clear();
 }
 
+/**
+ * @return: An iterator to the first station, in list order. The stations can be read through it, not replaced.
+*/
+template<class List>
+typename BasicStationManager<List>::const_iterator BasicStationManager<List>::begin() const {
+    return List::begin();
+}
+
+/**
+ * @return: An iterator past the last station.
+*/
+template<class List>
+typename BasicStationManager<List>::const_iterator BasicStationManager<List>::end() const {
+    return List::end();
+}
+
+/**
+ * Removes every station from the list without deallocating them.
+ * @post: The list is empty and all hit counts are reset.
+*/
+template<class List>
+void BasicStationManager<List>::clear() {
+    auto lock = writeLock();
+    // Stations may already be deallocated by their owner, so their listeners are disarmed through the token
+    listener_token_ = std::make_shared<BasicStationManager*>(this);
+    List::clear();
+    station_index_.clear();
+    dish_index_.clear();
+    floor_changes_++;
+    hit_counts_.clear();
+}
+
+/**
+ * Sets the policy applied when a lookup hits a station.
+ * @param policy The new AccessPolicy (NONE by default).
+ * @pre: No other thread is using the manager.
+ * @post: Later hits by findStation, prepareDishAtStation and canCompleteOrder, called on a manager that is not const,
+reorganize the list according to the policy.
+*/
+template<class List>
+void BasicStationManager<List>::setAccessPolicy(AccessPolicy policy) {
+    access_policy_ = policy;
+}
+
+/**
+ * @return: The policy applied when a lookup hits a station.
+*/
+template<class List>
+StationAccessPolicy::AccessPolicy BasicStationManager<List>::getAccessPolicy() const {
+    return access_policy_;
+}
+
+/**
+ * Sets how many stations must carry a dish for the searches given a ThreadPool to split them among its threads.
+ * @param carriers The number of stations carrying the dish (not the number of stations on the floor) from which a
+search goes to the pool; SERIAL_SEARCH keeps every search on the calling thread. The default is
+DEFAULT_PARALLEL_SEARCH on a machine with several hardware threads, SERIAL_SEARCH on one with a single thread.
+ * @pre: No other thread is using the manager.
+*/
+template<class List>
+void BasicStationManager<List>::setParallelSearchThreshold(std::size_t carriers) {
+    parallel_search_threshold_ = carriers;
+}
+
+/**
+ * @return: The number of stations carrying a dish from which a search goes to the pool.
+*/
+template<class List>
+std::size_t BasicStationManager<List>::getParallelSearchThreshold() const {
+    return parallel_search_threshold_;
+}
+
+/**
+ * Sets how the manager and its stations synchronize the threads that use them.
+ * @param mode The new KitchenStation::ConcurrencyMode (SINGLE_THREADED by default).
+ * @pre: No other thread is using the manager or its stations.
+ * @post: The manager's methods may be called from several threads in LOCKED and LOCK_FREE mode. They take the
+manager's lock, shared by lookups and orders and held alone by changes to the floor, then the station's own lock.
+Under an access policy other than NONE every hit changes the list, so lookups that record hits hold the manager's
+lock alone. The stations in the list and those added later use the same mode. Iterating over the manager and
+removing stations behind its back are never synchronized.
+*/
+template<class List>
+void BasicStationManager<List>::setConcurrencyMode(KitchenStation::ConcurrencyMode mode) {
+    concurrency_mode_ = mode;
+    for (KitchenStation* station : *this) {
+        station->setConcurrencyMode(mode);
+    }
+}
+
+/**
+ * @return: How the manager and its stations synchronize the threads that use them.
+*/
+template<class List>
+KitchenStation::ConcurrencyMode BasicStationManager<List>::getConcurrencyMode() const {
+    return concurrency_mode_;
+}
+
 /**
  * Adds a new station to the station manager.
  * @param station A pointer to a KitchenStation object.
- * @post: Inserts the station into the linked list.
+ * @post: Inserts the station into the linked list and indexes it by name and by the dishes it carries. Dishes
+assigned later are indexed too, whether through assignDishToStation or through KitchenStation::assignDishToStation,
+and reindexed when renamed.
  * @return: True if the station was successfully added; false otherwise.
 */
-bool StationManager::addStation(KitchenStation* station) {
-    return insert(getLength(), station);
+template<class List>
+bool BasicStationManager<List>::addStation(KitchenStation* station) {
+    auto lock = writeLock();
+    if (!adoptStation(station)) {
+        return false;
+    }
+    pushBack(station);  // Constant time: appends through the tail pointer
+    return true;
+}
+
+/**
+ * Inserts a station at a position of the list.
+ * @param position The position of the station, from 0 to getLength().
+ * @param station A pointer to a KitchenStation object.
+ * @post: As addStation, except that the station is inserted at position rather than at the end.
+ * @return: True if the station was inserted; false if position is out of range, the station is nullptr or another
+station already has its name.
+*/
+template<class List>
+bool BasicStationManager<List>::insert(int position, KitchenStation* station) {
+    auto lock = writeLock();
+    if (position < 0 || position > List::getLength() || !adoptStation(station)) {
+        return false;
+    }
+    List::insert(position, station);
+    return true;
+}
+
+/**
+ * Removes the station at a position of the list, without deallocating it.
+ * @param position The position of the station, from 0 to getLength() - 1.
+ * @post: The station is no longer indexed and no longer reports renames or dishes to this manager.
+ * @return: True if there was a station at position; false otherwise.
+*/
+template<class List>
+bool BasicStationManager<List>::remove(int position) {
+    auto lock = writeLock();
+    if (position < 0 || position >= List::getLength()) {
+        return false;
+    }
+    KitchenStation* station = List::getEntry(position);
+    forgetStation(station);
+    station->setRenameListener(nullptr);
+    station->setMenuListener(nullptr);
+    return List::remove(position);
+}
+
+/**
+ * Indexes a station joining the list and has it report to this manager.
+ * @param station A pointer to a KitchenStation object.
+ * @pre: The manager is locked exclusively.
+ * @post: The station is indexed by name and by the dishes it carries, reports renames and newly carried dishes, and
+follows the manager's concurrency mode. It is not in the list yet.
+ * @return: False, changing nothing, if the station is nullptr or another station already has its name.
+*/
+template<class List>
+bool BasicStationManager<List>::adoptStation(KitchenStation* station) {
+    if (!station || !station_index_.emplace(station->getNameSymbol(), station).second) {
+        return false;  // No station, or its name is already taken
+    }
+    std::weak_ptr<BasicStationManager*> token = listener_token_;
+    station->setRenameListener([token](const KitchenStation& renamed, const std::string& new_name) {
+        std::shared_ptr<BasicStationManager*> manager = token.lock();
+        return !manager || (*manager)->renameStation(renamed, new_name);
+    });
+    station->setMenuListener([token](const KitchenStation& carrier, Symbol dish_name, bool carried) {
+        if (std::shared_ptr<BasicStationManager*> manager = token.lock()) {
+            (*manager)->indexCarriedDish(carrier, dish_name, carried);
+        }
+    });
+    station->setConcurrencyMode(concurrency_mode_);
+    for (Symbol dish_name : station->getDishNames()) {
+        indexDish(station, dish_name);
+    }
+    return true;
 }
 
 /**
@@ -41,30 +224,70 @@ bool StationManager::addStation(KitchenStation* station) {
  * @post: Removes the station from the list and deallocates it.
  * @return: True if the station was found and removed; false otherwise.
 */
-bool StationManager::removeStation(const std::string& station_name) {
-    for (int i = 0; i < getLength(); i++) {
-        KitchenStation* station = getEntry(i);
-        if (station && station->getName() == station_name) {
-            delete station;
-            return remove(i);
-        }
+template<class List>
+bool BasicStationManager<List>::removeStation(const std::string& station_name) {
+    auto lock = writeLock();
+    KitchenStation* station = lookupStation(station_name);
+    if (!station) {
+        return false;
     }
-    return false;
+    iterator it = List::find(station);  // The index holds no list positions: see station_index_
+    forgetStation(station);
+    delete station;
+    erase(it);
+    return true;
 }
 
 /**
  * Finds a station in the station manager by name.
  * @param station_name A string representing the station's name.
+ * @return: A pointer to the KitchenStation if found; nullptr otherwise. No hit is recorded, so the list order does
+not change: this is the lookup of a const manager.
+*/
+template<class List>
+KitchenStation* BasicStationManager<List>::findStation(const std::string& station_name) const {
+    auto lock = readLock();
+    return lookupStation(station_name);
+}
+
+/**
+ * Finds a station in the station manager by name.
+ * @param station_name The interned name of the station.
+ * @return: As findStation by string, without hashing the name.
+*/
+template<class List>
+KitchenStation* BasicStationManager<List>::findStation(Symbol station_name) const {
+    auto lock = readLock();
+    return lookupStation(station_name);
+}
+
+/**
+ * Finds a station in the station manager by name and applies the access policy to it.
+ * @param station_name A string representing the station's name.
+ * @post: If found, the station is counted as a hit and may move closer to the front of the list, invalidating
+iterators over it.
  * @return: A pointer to the KitchenStation if found; nullptr otherwise.
 */
-KitchenStation* StationManager::findStation(const std::string& station_name) const {
-    for (int i = 0; i < getLength(); i++) {
-        KitchenStation* station = getEntry(i);
-        if (station && station->getName() == station_name) {
-            return station;
-        }
-    }
-    return nullptr;
+template<class List>
+KitchenStation* BasicStationManager<List>::findStation(const std::string& station_name) {
+    std::shared_lock<std::shared_mutex> reader;
+    std::unique_lock<std::shared_mutex> writer;
+    lockForHit(reader, writer);
+    return hitStation(lookupStation(station_name));
+}
+
+/**
+ * Finds a station in the station manager by name and applies the access policy to it.
+ * @param station_name The interned name of the station.
+ * @post: As findStation by string.
+ * @return: As findStation by string, without hashing the name.
+*/
+template<class List>
+KitchenStation* BasicStationManager<List>::findStation(Symbol station_name) {
+    std::shared_lock<std::shared_mutex> reader;
+    std::unique_lock<std::shared_mutex> writer;
+    lockForHit(reader, writer);
+    return hitStation(lookupStation(station_name));
 }
 
 /**
@@ -73,14 +296,15 @@ KitchenStation* StationManager::findStation(const std::string& station_name) con
  * @post: The station is moved to the front of the list if it exists.
  * @return: True if the station was found and moved; false otherwise.
 */
-bool StationManager::moveStationToFront(const std::string& station_name) {
-    for (int i = 0; i < getLength(); i++) {
-        if (KitchenStation* station = getEntry(i); station && station->getName() == station_name) {
-            remove(i);
-            return insert(0, station);
-        }
+template<class List>
+bool BasicStationManager<List>::moveStationToFront(const std::string& station_name) {
+    auto lock = writeLock();
+    KitchenStation* station = lookupStation(station_name);
+    if (!station) {
+        return false;
     }
-    return false;
+    moveToFront(List::find(station));  // Reorders in place, no allocation; found as in removeStation
+    return true;
 }
 
 /**
@@ -90,20 +314,31 @@ bool StationManager::moveStationToFront(const std::string& station_name) {
  * @post: The second station is removed from the list, and its contents are added to the first station.
  * @return: True if both stations were found and merged; false otherwise.
 */
-bool StationManager::mergeStations(const std::string& station_name1, const std::string& station_name2) {
-    KitchenStation* station1 = findStation(station_name1);
-    KitchenStation* station2 = findStation(station_name2);
+template<class List>
+bool BasicStationManager<List>::mergeStations(const std::string& station_name1, const std::string& station_name2) {
+    auto lock = writeLock();  // No order reaches station2 while its views are read
+    KitchenStation* station1 = lookupStation(station_name1);
+    KitchenStation* station2 = lookupStation(station_name2);
 
     if (station1 && station2 && station1 != station2) {
+        station2->setConcurrencyMode(KitchenStation::SINGLE_THREADED);  // Leaving the floor, so its views are current
         // Merge dishes from station2 into station1
-        for (Dish* dish : station2->getDishes()) {
-            station1->assignDishToStation(dish);
+        const BasicStationManager* outer = assigningManager();
+        assigningManager() = this;  // Indexed here, under the lock already held
+        for (Dish* dish : station2->viewDishes()) {
+            if (station1->assignDishToStation(dish)) {
+                indexDish(station1, dish->getNameSymbol());
+            }
         }
+        assigningManager() = outer;
         // Merge ingredients from station2 into station1
-        for (const Ingredient& ingredient : station2->getIngredientsStock()) {
+        for (const Ingredient& ingredient : station2->viewIngredientsStock()) {
             station1->replenishStationIngredients(ingredient);
         }
-        removeStation(station_name2);
+        iterator it2 = List::find(station2);
+        forgetStation(station2);
+        delete station2;
+        erase(it2);
         return true;
     }
     return false;
@@ -113,14 +348,25 @@ bool StationManager::mergeStations(const std::string& station_name1, const std::
  * Assigns a dish to a specific station.
  * @param station_name A string representing the station's name.
  * @param dish A pointer to a Dish object.
- * @post: Assigns the dish to the specified station.
+ * @post: Assigns the dish to the specified station and indexes the station under the dish's name.
  * @return: True if the station was found and the dish was assigned; false otherwise.
 */
-bool StationManager::assignDishToStation(const std::string& station_name, Dish* dish) {
-    if (KitchenStation* station = findStation(station_name)) {
-        return station->assignDishToStation(dish);
+template<class List>
+bool BasicStationManager<List>::assignDishToStation(const std::string& station_name, Dish* dish) {
+    auto lock = writeLock();
+    KitchenStation* station = lookupStation(station_name);
+    if (!station) {
+        return false;
     }
-    return false;
+    const BasicStationManager* outer = assigningManager();
+    assigningManager() = this;  // Indexed here, under the lock already held
+    const bool assigned = station->assignDishToStation(dish);
+    assigningManager() = outer;
+    if (!assigned) {
+        return false;
+    }
+    indexDish(station, dish->getNameSymbol());
+    return true;
 }
 
 /**
@@ -130,8 +376,10 @@ bool StationManager::assignDishToStation(const std::string& station_name, Dish*
  * @post: Replenishes the ingredient stock at the specified station.
  * @return: True if the station was found and the ingredient was replenished; false otherwise.
 */
-bool StationManager::replenishIngredientAtStation(const std::string& station_name, const Ingredient& ingredient) {
-    if (KitchenStation* station = findStation(station_name)) {
+template<class List>
+bool BasicStationManager<List>::replenishIngredientAtStation(const std::string& station_name, const Ingredient& ingredient) {
+    auto lock = readLock();  // The station locks itself for the change
+    if (KitchenStation* station = lookupStation(station_name)) {
         station->replenishStationIngredients(ingredient);
         return true;
     }
@@ -143,15 +391,178 @@ bool StationManager::replenishIngredientAtStation(const std::string& station_nam
 order for a specific dish.
  * @param dish_name A string representing the name of the dish.
  * @return: True if any station can complete the order; false
-otherwise.
+otherwise. Only the stations carrying the dish are asked. No hit is recorded: this is the check of a const manager.
+*/
+template<class List>
+bool BasicStationManager<List>::canCompleteOrder(const std::string& dish_name) const {
+    Symbol dish;
+    return Symbol::find(dish_name, dish) && canCompleteOrder(dish);  // A name never interned is carried nowhere
+}
+
+/**
+ * Checks if any station in the station manager can complete an order for a specific dish.
+ * @param dish_name The interned name of the dish.
+ * @return: As canCompleteOrder by string, without hashing the name.
+*/
+template<class List>
+bool BasicStationManager<List>::canCompleteOrder(Symbol dish_name) const {
+    auto lock = readLock();
+    auto entry = dish_index_.find(dish_name);
+    return entry != dish_index_.end() &&
+           std::any_of(entry->second.begin(), entry->second.end(), [&dish_name](const KitchenStation* station) {
+               return station->canCompleteOrder(dish_name);
+           });
+}
+
+/**
+ * Finds a station that can complete an order for a specific dish.
+ * @param dish_name The interned name of the dish.
+ * @return: One of the stations carrying the dish with all its ingredients in stock; nullptr if there is none. No hit
+is recorded.
+*/
+template<class List>
+KitchenStation* BasicStationManager<List>::findStationForOrder(Symbol dish_name) const {
+    auto lock = readLock();
+    auto entry = dish_index_.find(dish_name);
+    if (entry == dish_index_.end()) {
+        return nullptr;
+    }
+    auto able = std::find_if(entry->second.begin(), entry->second.end(), [&dish_name](const KitchenStation* station) {
+        return station->canCompleteOrder(dish_name);
+    });
+    return able != entry->second.end() ? *able : nullptr;
+}
+
+/**
+ * Finds a station that takes orders for a specific dish, whether or not its ingredients are in stock.
+ * @param dish_name The interned name of the dish.
+ * @return: One of the stations carrying the dish; nullptr if there is none. No hit is recorded.
+*/
+template<class List>
+KitchenStation* BasicStationManager<List>::findStationCarrying(Symbol dish_name) const {
+    auto lock = readLock();
+    auto entry = dish_index_.find(dish_name);
+    return entry != dish_index_.end() ? entry->second.front() : nullptr;  // Names left without stations are dropped
+}
+
+/**
+ * Checks if any station in the station manager can complete an order for a specific dish, asking the stations
+carrying it on several threads.
+ * @param dish_name A string representing the name of the dish.
+ * @param pool The threads that share the search with this one.
+ * @return: As canCompleteOrder. The stations carrying the dish are split among the threads, which all stop once one of
+them finds an able station. Below the parallel search threshold, they are asked on this thread alone. No hit is
+recorded.
+*/
+template<class List>
+bool BasicStationManager<List>::canCompleteOrder(const std::string& dish_name, ThreadPool& pool) const {
+    Symbol dish;
+    return Symbol::find(dish_name, dish) && canCompleteOrder(dish, pool);
+}
+
+/**
+ * Checks if any station in the station manager can complete an order for a specific dish, asking the stations
+carrying it on several threads.
+ * @param dish_name The interned name of the dish.
+ * @param pool The threads that share the search with this one.
+ * @return: As canCompleteOrder by string and pool, without hashing the name.
+*/
+template<class List>
+bool BasicStationManager<List>::canCompleteOrder(Symbol dish_name, ThreadPool& pool) const {
+    return searchStations(dish_name, pool, nullptr);
+}
+
+/**
+ * Finds every station that can complete an order for a specific dish, asking the stations carrying it on several
+threads.
+ * @param dish_name A string representing the name of the dish.
+ * @param pool The threads that share the search with this one.
+ * @return: The stations carrying the dish with all its ingredients in stock, in the same order whatever the number of
+threads. Below the parallel search threshold, they are asked on this thread alone. No hit is recorded.
+*/
+template<class List>
+std::vector<KitchenStation*> BasicStationManager<List>::findStationsForOrder(const std::string& dish_name,
+                                                                           ThreadPool& pool) const {
+    Symbol dish;
+    return Symbol::find(dish_name, dish) ? findStationsForOrder(dish, pool) : std::vector<KitchenStation*>();
+}
+
+/**
+ * Finds every station that can complete an order for a specific dish, asking the stations carrying it on several
+threads.
+ * @param dish_name The interned name of the dish.
+ * @param pool The threads that share the search with this one.
+ * @return: As findStationsForOrder by string, without hashing the name.
 */
-bool StationManager::canCompleteOrder(const std::string& dish_name) const {
-    for (int i = 0; i < getLength(); i++) {
-        if (KitchenStation* station = getEntry(i); station && station->canCompleteOrder(dish_name)) {
-            return true;
+template<class List>
+std::vector<KitchenStation*> BasicStationManager<List>::findStationsForOrder(Symbol dish_name, ThreadPool& pool) const {
+    std::vector<KitchenStation*> able;
+    searchStations(dish_name, pool, &able);
+    return able;
+}
+
+/**
+ * Checks if any station in the station manager can complete an order for a specific dish, and applies the access
+policy to it.
+ * @param dish_name A string representing the name of the dish.
+ * @post: The first station able to complete the order is counted as a hit and may move closer to the front of the list,
+invalidating iterators over it.
+ * @return: True if any station can complete the order; false otherwise. Only the stations carrying the dish are
+asked.
+*/
+template<class List>
+bool BasicStationManager<List>::canCompleteOrder(const std::string& dish_name) {
+    Symbol dish;
+    return Symbol::find(dish_name, dish) && canCompleteOrder(dish);
+}
+
+/**
+ * Checks if any station in the station manager can complete an order for a specific dish, and applies the access
+policy to it.
+ * @param dish_name The interned name of the dish.
+ * @post: As canCompleteOrder by string.
+ * @return: As canCompleteOrder by string, without hashing the name.
+*/
+template<class List>
+bool BasicStationManager<List>::canCompleteOrder(Symbol dish_name) {
+    std::shared_lock<std::shared_mutex> reader;
+    std::unique_lock<std::shared_mutex> writer;
+    lockForHit(reader, writer);
+    auto entry = dish_index_.find(dish_name);
+    if (entry == dish_index_.end()) {
+        return false;
+    }
+    auto can_complete = [&dish_name](const KitchenStation* station) {
+        return station->canCompleteOrder(dish_name);
+    };
+    if (access_policy_ == NONE) {
+        // No hit to record, so no need to know which station comes first: the first able one answers
+        return std::any_of(entry->second.begin(), entry->second.end(), can_complete);
+    }
+    KitchenStation* first_able = nullptr;
+    std::size_t able = 0;
+    for (KitchenStation* station : entry->second) {
+        if (can_complete(station) && able++ == 0) {
+            first_able = station;
         }
     }
-    return false;
+    if (able == 0) {
+        return false;
+    }
+
+    // The hit goes to the able station nearest the front; a lone one is found without walking the list
+    iterator previous = List::end();
+    iterator it = List::begin();
+    if (able == 1 && access_policy_ != TRANSPOSE) {
+        it = List::find(first_able);
+    } else {
+        while (!(*it)->canCompleteOrder(dish_name)) {  // Constant time per station
+            previous = it;
+            ++it;
+        }
+    }
+    recordHit(previous, it);
+    return true;
 }
 
 /**
@@ -163,9 +574,408 @@ used ingredients at the station.
  * @return: True if the dish was prepared successfully; false
 otherwise.
 */
-bool StationManager::prepareDishAtStation(const std::string& station_name, const std::string& dish_name) {
-    if (KitchenStation* station = findStation(station_name)) {
+template<class List>
+bool BasicStationManager<List>::prepareDishAtStation(const std::string& station_name, const std::string& dish_name) {
+    std::shared_lock<std::shared_mutex> reader;
+    std::unique_lock<std::shared_mutex> writer;
+    lockForHit(reader, writer);  // Held until the station is done, so that it cannot be removed meanwhile
+    if (KitchenStation* station = hitStation(lookupStation(station_name))) {
         return station->prepareDish(dish_name);
     }
     return false;
+}
+
+/**
+ * Prepares several servings of a dish at a specific station, if possible.
+ * @param station_name A string representing the station's name.
+ * @param dish_name A string representing the name of the dish.
+ * @param count The number of servings to prepare, all or none.
+ * @post: If all the servings can be prepared, reduces the quantities of the used ingredients at the station by
+count times the required quantities.
+ * @return: True if the servings were prepared; false otherwise.
+*/
+template<class List>
+bool BasicStationManager<List>::prepareDishAtStation(const std::string& station_name, const std::string& dish_name,
+                                                     int count) {
+    std::shared_lock<std::shared_mutex> reader;
+    std::unique_lock<std::shared_mutex> writer;
+    lockForHit(reader, writer);
+    if (KitchenStation* station = hitStation(lookupStation(station_name))) {
+        return station->prepareDish(dish_name, count);  // One lookup and one hit for the whole ticket
+    }
+    return false;
+}
+
+/**
+ * Counts how many servings of a dish a specific station can prepare.
+ * @param station_name A string representing the station's name.
+ * @param dish_name A string representing the name of the dish.
+ * @return: KitchenStation::maxServings of the station; 0 if there is no station of that name.
+*/
+template<class List>
+int BasicStationManager<List>::maxServingsAtStation(const std::string& station_name,
+                                                    const std::string& dish_name) const {
+    auto lock = readLock();
+    const KitchenStation* station = lookupStation(station_name);
+    return station ? station->maxServings(dish_name) : 0;
+}
+
+/**
+ * Lists, for every station, the dishes it can prepare right now.
+ * @return: Each station with at least one available dish, in list order, paired with
+KitchenStation::getAvailableDishes of it.
+*/
+template<class List>
+std::vector<std::pair<KitchenStation*, std::vector<Dish*>>> BasicStationManager<List>::getAvailableDishes() const {
+    auto lock = readLock();
+    std::vector<std::pair<KitchenStation*, std::vector<Dish*>>> available;
+    for (KitchenStation* station : *this) {
+        std::vector<Dish*> dishes = station->getAvailableDishes();
+        if (!dishes.empty()) {
+            available.emplace_back(station, std::move(dishes));
+        }
+    }
+    return available;
+}
+
+/**
+ * Looks a station up in the name index.
+ * @param station_name A string representing the station's name.
+ * @return: A pointer to the KitchenStation if found; nullptr otherwise.
+*/
+template<class List>
+KitchenStation* BasicStationManager<List>::lookupStation(const std::string& station_name) const {
+    Symbol name;
+    if (!Symbol::find(station_name, name)) {
+        return nullptr;  // Never interned, so no station has it
+    }
+    return lookupStation(name);
+}
+
+/**
+ * Looks a station up in the name index.
+ * @param station_name The interned name of the station.
+ * @return: A pointer to the KitchenStation if found; nullptr otherwise.
+*/
+template<class List>
+KitchenStation* BasicStationManager<List>::lookupStation(Symbol station_name) const {
+    auto entry = station_index_.find(station_name);
+    return entry != station_index_.end() ? entry->second : nullptr;
+}
+
+/**
+ * Applies the access policy to a station just looked up, without locking.
+ * @param station The station found, or nullptr if there was none.
+ * @post: As findStation, if station is not nullptr.
+ * @return: station.
+*/
+template<class List>
+KitchenStation* BasicStationManager<List>::hitStation(KitchenStation* station) {
+    if (station && access_policy_ != NONE) {
+        // Only a reorganizing policy needs the station's position in the list,
+        // and only TRANSPOSE needs the station before it
+        iterator previous = List::end();
+        iterator it = access_policy_ == TRANSPOSE ? locateStation(station, previous) : List::find(station);
+        recordHit(previous, it);
+    }
+    return station;
+}
+
+/**
+ * Asks the stations carrying a dish whether they can complete an order for it, on the calling thread or, from the
+parallel search threshold on, on a pool. The manager's lock is not held across the pool's job: each task holds it
+while it asks its chunk, and if the floor changed meanwhile the search is run again on this thread.
+ * @param dish_name The interned name of the dish.
+ * @param pool The threads that share the search with this one.
+ * @param able Set to every able station if not nullptr; the search stops at the first one otherwise.
+ * @return: True if an able station was found.
+*/
+template<class List>
+bool BasicStationManager<List>::searchStations(Symbol dish_name, ThreadPool& pool,
+                                               std::vector<KitchenStation*>* able) const {
+    auto can_complete = [&dish_name](const KitchenStation* station) {
+        return station->canCompleteOrder(dish_name);
+    };
+    auto search_here = [&](const std::vector<KitchenStation*>& carriers) {
+        if (able == nullptr) {
+            return std::any_of(carriers.begin(), carriers.end(), can_complete);
+        }
+        std::copy_if(carriers.begin(), carriers.end(), std::back_inserter(*able), can_complete);
+        return !able->empty();
+    };
+    auto lock = readLock();
+    auto entry = dish_index_.find(dish_name);
+    if (entry == dish_index_.end()) {
+        return false;
+    }
+    const std::vector<KitchenStation*>& carriers = entry->second;  // Stays put until the floor changes
+    if (carriers.size() < parallel_search_threshold_ || pool.getThreadCount() == 0) {
+        return search_here(carriers);
+    }
+    const std::size_t changes = floor_changes_;
+    const std::size_t carrier_count = carriers.size();
+    lock = std::shared_lock<std::shared_mutex>();  // Writers wait for one chunk at most, not for the pool
+
+    // Each chunk keeps its own finds, joined in chunk order afterwards, so the result does not depend on the timing
+    const std::size_t chunks = (carrier_count + PARALLEL_SEARCH_CHUNK - 1) / PARALLEL_SEARCH_CHUNK;
+    std::vector<std::vector<KitchenStation*>> chunk_able(able != nullptr ? chunks : 0);
+    std::atomic<bool> found(false);
+    std::atomic<bool> changed(false);
+    pool.run(chunks, [&](std::size_t chunk) {
+        if (changed.load(std::memory_order_relaxed) || (able == nullptr && found.load(std::memory_order_relaxed))) {
+            return;  // The answer is known, or will come from the search on the calling thread
+        }
+        auto chunk_lock = readLock();
+        if (floor_changes_ != changes) {
+            changed.store(true, std::memory_order_relaxed);  // The stations may have left: not one is touched
+            return;
+        }
+        const std::size_t last = std::min(carrier_count, (chunk + 1) * PARALLEL_SEARCH_CHUNK);
+        for (std::size_t i = chunk * PARALLEL_SEARCH_CHUNK; i < last; i++) {
+            if (able == nullptr && found.load(std::memory_order_relaxed)) {
+                return;  // Another thread found one: the answer is known
+            }
+            if (can_complete(carriers[i])) {
+                if (able == nullptr) {
+                    found.store(true, std::memory_order_relaxed);
+                    return;
+                }
+                chunk_able[chunk].push_back(carriers[i]);
+            }
+        }
+    });
+    // The pool's threads are done
+    if (able == nullptr && found.load(std::memory_order_relaxed)) {
+        return true;
+    }
+    if (changed.load(std::memory_order_relaxed)) {
+        lock = readLock();
+        entry = dish_index_.find(dish_name);
+        return entry != dish_index_.end() && search_here(entry->second);
+    }
+    if (able == nullptr) {
+        return false;
+    }
+    for (const std::vector<KitchenStation*>& part : chunk_able) {
+        able->insert(able->end(), part.begin(), part.end());
+    }
+    return !able->empty();
+}
+
+/**
+ * @return: A lock on the manager shared with other readers, held only in LOCKED mode.
+*/
+template<class List>
+std::shared_lock<std::shared_mutex> BasicStationManager<List>::readLock() const {
+    if (concurrency_mode_ == KitchenStation::SINGLE_THREADED) {
+        return std::shared_lock<std::shared_mutex>();
+    }
+    return std::shared_lock<std::shared_mutex>(mutex_);
+}
+
+/**
+ * @return: A lock on the manager excluding every other thread, held only in LOCKED mode.
+*/
+template<class List>
+std::unique_lock<std::shared_mutex> BasicStationManager<List>::writeLock() const {
+    if (concurrency_mode_ == KitchenStation::SINGLE_THREADED) {
+        return std::unique_lock<std::shared_mutex>();
+    }
+    return std::unique_lock<std::shared_mutex>(mutex_);
+}
+
+/**
+ * Locks the manager for a lookup that may record a hit: shared if the access policy is NONE, exclusive otherwise.
+Holds nothing in SINGLE_THREADED mode.
+ * @param reader Set to the shared lock, if taken.
+ * @param writer Set to the exclusive lock, if taken.
+*/
+template<class List>
+void BasicStationManager<List>::lockForHit(std::shared_lock<std::shared_mutex>& reader,
+                                           std::unique_lock<std::shared_mutex>& writer) const {
+    if (access_policy_ == NONE) {
+        reader = readLock();
+    } else {
+        writer = writeLock();
+    }
+}
+
+/**
+ * Locates a station of this manager in the list.
+ * @param station A pointer to a station registered with this manager.
+ * @param previous Set to an iterator to the station before it; end() if it is at the head.
+ * @return: An iterator to the station.
+*/
+template<class List>
+typename BasicStationManager<List>::iterator BasicStationManager<List>::locateStation(const KitchenStation* station, iterator& previous) {
+    previous = List::end();
+    iterator it = List::begin();
+    while (*it != station) {  // Pointer compares only, the station is known to be in the list
+        previous = it;
+        ++it;
+    }
+    return it;
+}
+
+/**
+ * Keeps the name index in step with a station being renamed.
+ * @param station The station, still under its old name.
+ * @param new_name The requested name.
+ * @post: The index maps new_name to the station, unless the name is taken. A station this manager does not index
+is left alone.
+ * @return: True if the rename may proceed; false if another station has that name.
+*/
+template<class List>
+bool BasicStationManager<List>::renameStation(const KitchenStation& station, const std::string& new_name) {
+    const Symbol name(new_name);
+    auto lock = writeLock();
+    if (name == station.getNameSymbol()) {
+        return true;
+    }
+    auto entry = station_index_.find(station.getNameSymbol());
+    if (entry == station_index_.end() || entry->second != &station) {
+        return true;  // Not indexed here, e.g. registered with another manager since: nothing to keep in step
+    }
+    if (!station_index_.emplace(name, entry->second).second) {
+        return false;  // Names stay unique within the manager
+    }
+    station_index_.erase(entry);
+    return true;
+}
+
+/**
+ * Counts a hit on a station and reorganizes the list according to the access policy.
+ * @param previous An iterator to the station before the hit one; end() if the hit station is at the head.
+ * @param hit An iterator to the station that was hit.
+ * @post: The station may have moved. Both iterators are invalidated.
+*/
+template<class List>
+void BasicStationManager<List>::recordHit(iterator previous, iterator hit) {
+    switch (access_policy_) {
+        case MOVE_TO_FRONT:
+            moveToFront(hit);
+            break;
+        case TRANSPOSE:
+            if (previous != List::end()) {
+                using std::iter_swap;
+                iter_swap(previous, hit);  // A list may supply its own swap, found by argument-dependent lookup
+            }
+            break;
+        case COUNT_ORDERED: {
+            std::size_t count = ++hit_counts_[*hit];
+            // Relink the station before the first one with fewer hits
+            iterator before = List::end();
+            iterator cur = List::begin();
+            while (cur != hit) {
+                auto counted = hit_counts_.find(*cur);  // Looked up without inserting: a station never hit has none
+                if (counted == hit_counts_.end() || counted->second < count) {
+                    break;
+                }
+                before = cur;
+                ++cur;
+            }
+            if (cur != hit) {
+                if (before == List::end()) {
+                    moveToFront(hit);
+                } else {
+                    spliceAfter(before, hit);
+                }
+            }
+            break;
+        }
+        case NONE:
+        default:
+            break;
+    }
+}
+
+/**
+ * Keeps the dish index in step with a dish assigned to a station directly, rather than through the manager, or
+renamed or changed after its assignment.
+ * @param station The station.
+ * @param dish_name The name it now takes, or no longer takes, orders for.
+ * @param carried Whether the station now takes orders for dish_name.
+ * @post: The station is listed under dish_name if and only if carried. A station this manager does not index is
+left alone, and so is a dish the manager is assigning itself, which it indexes under the lock it holds.
+*/
+template<class List>
+void BasicStationManager<List>::indexCarriedDish(const KitchenStation& station, Symbol dish_name, bool carried) {
+    if (assigningManager() == this) {
+        return;  // Taking the lock again would deadlock
+    }
+    auto lock = writeLock();
+    auto entry = station_index_.find(station.getNameSymbol());
+    if (entry == station_index_.end() || entry->second != &station) {
+        return;  // Not indexed here, e.g. registered with another manager since: nothing to keep in step
+    }
+    if (carried) {
+        indexDish(entry->second, dish_name);
+    } else {
+        unindexDish(entry->second, dish_name);
+    }
+}
+
+/**
+ * @return: The manager assigning dishes to its stations on this thread, if any, so that it can tell its own
+assignments from others when a station reports them.
+*/
+template<class List>
+const BasicStationManager<List>*& BasicStationManager<List>::assigningManager() {
+    thread_local const BasicStationManager* manager = nullptr;
+    return manager;
+}
+
+/**
+ * Records that a station carries a dish.
+ * @param station A pointer to a station of this manager.
+ * @param dish_name The name the station takes orders for.
+ * @post: The station is listed under dish_name, once.
+*/
+template<class List>
+void BasicStationManager<List>::indexDish(KitchenStation* station, Symbol dish_name) {
+    std::vector<KitchenStation*>& stations = dish_index_[dish_name];
+    if (std::find(stations.begin(), stations.end(), station) == stations.end()) {
+        stations.push_back(station);
+    }
+    floor_changes_++;
+}
+
+/**
+ * Records that a station no longer carries a dish.
+ * @param station A pointer to a station of this manager.
+ * @param dish_name The name the station stopped taking orders for.
+ * @post: The station is not listed under dish_name. A name left without stations is dropped.
+*/
+template<class List>
+void BasicStationManager<List>::unindexDish(KitchenStation* station, Symbol dish_name) {
+    auto entry = dish_index_.find(dish_name);
+    if (entry == dish_index_.end()) {
+        return;  // Assigned behind the manager's back, so never indexed
+    }
+    std::vector<KitchenStation*>& stations = entry->second;
+    auto it = std::find(stations.begin(), stations.end(), station);
+    if (it == stations.end()) {
+        return;
+    }
+    *it = stations.back();  // The order of the stations under a dish does not matter
+    stations.pop_back();
+    if (stations.empty()) {
+        dish_index_.erase(entry);
+    }
+    floor_changes_++;
+}
+
+/**
+ * Drops a station that leaves the list from the name index, the dish index and the hit counts.
+ * @param station A pointer to the departing station.
+ * @post: The station is no longer indexed.
+*/
+template<class List>
+void BasicStationManager<List>::forgetStation(KitchenStation* station) {
+    station_index_.erase(station->getNameSymbol());
+    for (Symbol dish_name : station->getDishNames()) {
+        unindexDish(station, dish_name);
+    }
+    floor_changes_++;
+    hit_counts_.erase(station);
 }
\ No newline at end of file
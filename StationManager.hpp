@@ -12,29 +12,160 @@
 #ifndef STATION_MANAGER_HPP
 #define STATION_MANAGER_HPP
 
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 #include "LinkedList.hpp"
+#include "UnrolledList.hpp"
+#include "SkipList.hpp"
+#include "VectorList.hpp"
+#include "HashedList.hpp"
 #include "KitchenStation.hpp"
+#include "ThreadPool.hpp"
 
-class StationManager : public LinkedList<KitchenStation*> {
+/**
+ * The access policies are shared by every BasicStationManager, whatever list it is built on.
+ */
+class StationAccessPolicy {
 public:
+    /**
+     * How the list reorganizes itself when a lookup hits a station.
+     * - NONE: The list order never changes on its own.
+     * - MOVE_TO_FRONT: The station hit is moved to the head of the list.
+     * - TRANSPOSE: The station hit trades places with the one before it.
+     * - COUNT_ORDERED: The list is kept sorted by hit count, most hit first.
+     */
+    enum AccessPolicy { NONE, MOVE_TO_FRONT, TRANSPOSE, COUNT_ORDERED };
+};
+
+/**
+ * The list holding the stations is chosen at compile time. It must offer the LinkedList interface used here:
+ * pushBack, pushFront, emplace, insert, remove, clear, getLength, getEntry, find, forward iterators with erase,
+ * moveToFront and spliceAfter, and iter_swap on its iterators. The list is a public base, as LinkedList was before
+ * the list became a parameter: insert, remove and clear are redeclared here to keep the indexes in step, and the
+ * other members that add, drop or replace stations are private.
+ * @param List The station list, e.g. StationList, UnrolledStationList, SkipStationList, VectorStationList or
+ * HashedStationList.
+ */
+template<class List>
+class BasicStationManager : public List, public StationAccessPolicy {
+public:
+    using const_iterator = typename List::const_iterator;
+
     /**
     * Default Constructor
     * @post: Initializes an empty station manager.
     */
-    StationManager();
+    BasicStationManager();
 
     /**
     * Destructor
     * @post: Deallocates all kitchen stations and clears the list.
     */
-    ~StationManager();
+    ~BasicStationManager();
+
+    // Stations hold a rename listener that refers back to their manager
+    BasicStationManager(const BasicStationManager& other) = delete;
+    BasicStationManager& operator=(const BasicStationManager& other) = delete;
+
+    /**
+    * @return: An iterator to the first station, in list order. The
+    stations can be read through it, not replaced.
+    */
+    const_iterator begin() const;
+
+    /**
+    * @return: An iterator past the last station.
+    */
+    const_iterator end() const;
+
+    /**
+    * Removes every station from the list without deallocating them.
+    * @post: The list is empty, the name index and all hit counts are
+    reset, and the stations no longer report renames to this manager.
+    */
+    void clear();
+
+    /**
+    * Sets the policy applied when a lookup hits a station.
+    * @param policy The new AccessPolicy (NONE by default).
+    * @pre: No other thread is using the manager.
+    * @post: Later hits by findStation, prepareDishAtStation and
+    canCompleteOrder, called on a manager that is not const, reorganize
+    the list according to the policy.
+    */
+    void setAccessPolicy(AccessPolicy policy);
+
+    /**
+    * @return: The policy applied when a lookup hits a station.
+    */
+    AccessPolicy getAccessPolicy() const;
+
+    /**
+    * Sets how many stations must carry a dish for the searches given a
+    ThreadPool to split them among its threads.
+    * @param carriers The number of stations carrying the dish (not the
+    number of stations on the floor) from which a search goes to the
+    pool; SERIAL_SEARCH keeps every search on the calling thread. The
+    default is DEFAULT_PARALLEL_SEARCH on a machine with several
+    hardware threads, SERIAL_SEARCH on one with a single thread.
+    * @pre: No other thread is using the manager.
+    */
+    void setParallelSearchThreshold(std::size_t carriers);
+
+    /**
+    * @return: The number of stations carrying a dish from which a
+    search goes to the pool.
+    */
+    std::size_t getParallelSearchThreshold() const;
+
+    // No search goes to the pool. The default on a single hardware thread, where the pool takes turns with the caller
+    static constexpr std::size_t SERIAL_SEARCH = std::numeric_limits<std::size_t>::max();
+
+    // The default on several hardware threads: in benchmarks/search_bench.cpp, the pool answered a miss among 16384
+    // carriers in about half the time of the caller alone, while on small floors waking it costs what it saves
+    static constexpr std::size_t DEFAULT_PARALLEL_SEARCH = 4096;
+
+    /**
+    * Sets how the manager and its stations synchronize the threads that
+    use them.
+    * @param mode The new KitchenStation::ConcurrencyMode
+    (SINGLE_THREADED by default).
+    * @pre: No other thread is using the manager or its stations.
+    * @post: The manager's methods may be called from several threads
+    in LOCKED and LOCK_FREE mode. They take the manager's lock, shared
+    by lookups and orders and held alone by changes to the floor, then
+    the station's own lock. Under an access policy other than NONE every hit changes
+    the list, so lookups that record hits hold the manager's lock alone.
+    The stations in the list and those added later use the same mode.
+    Iterating over the manager and removing stations behind its back
+    are never synchronized.
+    */
+    void setConcurrencyMode(KitchenStation::ConcurrencyMode mode);
+
+    /**
+    * @return: How the manager and its stations synchronize the threads
+    that use them.
+    */
+    KitchenStation::ConcurrencyMode getConcurrencyMode() const;
 
     /**
     * Adds a new station to the station manager.
     * @param station A pointer to a KitchenStation object.
-    * @post: Inserts the station into the linked list.
-    * @return: True if the station was successfully added; false
-    otherwise.
+    * @post: Inserts the station at the end of the linked list and
+    indexes it by name and by the dishes it carries. Renaming the
+    station through KitchenStation::setName keeps the index up to date;
+    a rename to a name already in use is refused. Dishes assigned later
+    are indexed too, whether through assignDishToStation or through
+    KitchenStation::assignDishToStation, and reindexed when renamed.
+    * @return: True if the station was successfully added; false if it
+    is nullptr or another station already has its name.
     */
     bool addStation(KitchenStation* station);
 
@@ -47,14 +178,67 @@ public:
     */
     bool removeStation(const std::string& station_name);
 
+    /**
+    * Inserts a station at a position of the list.
+    * @param position The position of the station, from 0 to
+    getLength().
+    * @param station A pointer to a KitchenStation object.
+    * @post: As addStation, except that the station is inserted at
+    position rather than at the end.
+    * @return: True if the station was inserted; false if position is
+    out of range, the station is nullptr or another station already has
+    its name.
+    */
+    bool insert(int position, KitchenStation* station);
+
+    /**
+    * Removes the station at a position of the list, without
+    deallocating it.
+    * @param position The position of the station, from 0 to
+    getLength() - 1.
+    * @post: The station is no longer indexed and no longer reports
+    renames or dishes to this manager.
+    * @return: True if there was a station at position; false
+    otherwise.
+    */
+    bool remove(int position);
+
     /**
     * Finds a station in the station manager by name.
     * @param station_name A string representing the station's name.
     * @return: A pointer to the KitchenStation if found; nullptr
-    otherwise.
+    otherwise. No hit is recorded, so the list order does not change:
+    this is the lookup of a const manager.
     */
     KitchenStation* findStation(const std::string& station_name) const;
 
+    /**
+    * Finds a station in the station manager by name.
+    * @param station_name The interned name of the station.
+    * @return: As findStation by string, without hashing the name.
+    */
+    KitchenStation* findStation(Symbol station_name) const;
+
+    /**
+    * Finds a station in the station manager by name and applies the
+    access policy to it.
+    * @param station_name A string representing the station's name.
+    * @post: If found, the station is counted as a hit and may move
+    closer to the front of the list, invalidating iterators over it.
+    * @return: A pointer to the KitchenStation if found; nullptr
+    otherwise.
+    */
+    KitchenStation* findStation(const std::string& station_name);
+
+    /**
+    * Finds a station in the station manager by name and applies the
+    access policy to it.
+    * @param station_name The interned name of the station.
+    * @post: As findStation by string.
+    * @return: As findStation by string, without hashing the name.
+    */
+    KitchenStation* findStation(Symbol station_name);
+
     /**
     * Moves a specified station to the front of the station manager
     list.
@@ -81,7 +265,8 @@ public:
     * Assigns a dish to a specific station.
     * @param station_name A string representing the station's name.
     * @param dish A pointer to a Dish object.
-    * @post: Assigns the dish to the specified station.
+    * @post: Assigns the dish to the specified station and indexes the
+    station under the dish's name.
     * @return: True if the station was found and the dish was assigned;
     false otherwise.
     */
@@ -102,20 +287,341 @@ public:
     order for a specific dish.
     * @param dish_name A string representing the name of the dish.
     * @return: True if any station can complete the order; false
-    otherwise.
+    otherwise. Only the stations carrying the dish are asked. No hit is
+    recorded, so the list order does not change: this is the check of a
+    const manager.
     */
     bool canCompleteOrder(const std::string& dish_name) const;
 
+    /**
+    * Checks if any station in the station manager can complete an
+    order for a specific dish.
+    * @param dish_name The interned name of the dish.
+    * @return: As canCompleteOrder by string, without hashing the name.
+    */
+    bool canCompleteOrder(Symbol dish_name) const;
+
+    /**
+    * Finds a station that can complete an order for a specific dish.
+    * @param dish_name The interned name of the dish.
+    * @return: One of the stations carrying the dish with all its
+    ingredients in stock; nullptr if there is none. No hit is recorded.
+    */
+    KitchenStation* findStationForOrder(Symbol dish_name) const;
+
+    /**
+    * Finds a station that takes orders for a specific dish, whether or
+    not its ingredients are in stock.
+    * @param dish_name The interned name of the dish.
+    * @return: One of the stations carrying the dish; nullptr if there
+    is none. No hit is recorded.
+    */
+    KitchenStation* findStationCarrying(Symbol dish_name) const;
+
+    /**
+    * Checks if any station in the station manager can complete an
+    order for a specific dish, asking the stations carrying it on
+    several threads.
+    * @param dish_name A string representing the name of the dish.
+    * @param pool The threads that share the search with this one.
+    * @return: As canCompleteOrder. The stations carrying the dish are
+    split among the threads, which all stop once one of them finds an
+    able station. Below the parallel search threshold, they are asked on
+    this thread alone. No hit is recorded.
+    */
+    bool canCompleteOrder(const std::string& dish_name, ThreadPool& pool) const;
+
+    /**
+    * Checks if any station in the station manager can complete an
+    order for a specific dish, asking the stations carrying it on
+    several threads.
+    * @param dish_name The interned name of the dish.
+    * @param pool The threads that share the search with this one.
+    * @return: As canCompleteOrder by string and pool, without hashing
+    the name.
+    */
+    bool canCompleteOrder(Symbol dish_name, ThreadPool& pool) const;
+
+    /**
+    * Finds every station that can complete an order for a specific
+    dish, asking the stations carrying it on several threads.
+    * @param dish_name A string representing the name of the dish.
+    * @param pool The threads that share the search with this one.
+    * @return: The stations carrying the dish with all its ingredients in
+    stock, in the same order whatever the number of threads. Below the
+    parallel search threshold, they are asked on this thread alone. No
+    hit is recorded.
+    */
+    std::vector<KitchenStation*> findStationsForOrder(const std::string& dish_name, ThreadPool& pool) const;
+
+    /**
+    * Finds every station that can complete an order for a specific
+    dish, asking the stations carrying it on several threads.
+    * @param dish_name The interned name of the dish.
+    * @param pool The threads that share the search with this one.
+    * @return: As findStationsForOrder by string, without hashing the
+    name.
+    */
+    std::vector<KitchenStation*> findStationsForOrder(Symbol dish_name, ThreadPool& pool) const;
+
+    /**
+    * Checks if any station in the station manager can complete an
+    order for a specific dish, and applies the access policy to it.
+    * @param dish_name A string representing the name of the dish.
+    * @post: The first station able to complete the order is counted
+    as a hit and may move closer to the front of the list, invalidating
+    iterators over it.
+    * @return: True if any station can complete the order; false
+    otherwise. Only the stations carrying the dish are asked.
+    */
+    bool canCompleteOrder(const std::string& dish_name);
+
+    /**
+    * Checks if any station in the station manager can complete an
+    order for a specific dish, and applies the access policy to it.
+    * @param dish_name The interned name of the dish.
+    * @post: As canCompleteOrder by string.
+    * @return: As canCompleteOrder by string, without hashing the name.
+    */
+    bool canCompleteOrder(Symbol dish_name);
+
     /**
     * Prepares a dish at a specific station if possible.
     * @param station_name A string representing the station's name.
     * @param dish_name A string representing the name of the dish.
     * @post: If the dish can be prepared, reduces the quantities of the
-    used ingredients at the station.
+    used ingredients at the station. A station found by name is counted
+    as a hit for the access policy.
     * @return: True if the dish was prepared successfully; false
     otherwise.
     */
     bool prepareDishAtStation(const std::string& station_name, const std::string& dish_name);
+
+    /**
+    * Prepares several servings of a dish at a specific station, if
+    possible.
+    * @param station_name A string representing the station's name.
+    * @param dish_name A string representing the name of the dish.
+    * @param count The number of servings to prepare, all or none.
+    * @post: If all the servings can be prepared, reduces the quantities
+    of the used ingredients at the station by count times the required
+    quantities. A station found by name is counted as a hit for the
+    access policy.
+    * @return: True if the servings were prepared; false otherwise.
+    */
+    bool prepareDishAtStation(const std::string& station_name, const std::string& dish_name, int count);
+
+    /**
+    * Counts how many servings of a dish a specific station can prepare.
+    * @param station_name A string representing the station's name.
+    * @param dish_name A string representing the name of the dish.
+    * @return: KitchenStation::maxServings of the station; 0 if there is
+    no station of that name.
+    */
+    int maxServingsAtStation(const std::string& station_name, const std::string& dish_name) const;
+
+    /**
+    * Lists, for every station, the dishes it can prepare right now.
+    * @return: Each station with at least one available dish, in list
+    order, paired with KitchenStation::getAvailableDishes of it.
+    */
+    std::vector<std::pair<KitchenStation*, std::vector<Dish*>>> getAvailableDishes() const;
+
+private:
+    // Change the list without the indexes, or hand out iterators that could replace a station
+    using iterator = typename List::iterator;
+    using List::find;
+    using List::erase;
+    using List::moveToFront;
+    using List::spliceAfter;
+    using List::pushBack;
+    using List::pushFront;
+    using List::emplace;
+
+    /**
+    * Indexes a station joining the list and has it report to this
+    manager.
+    * @param station A pointer to a KitchenStation object.
+    * @pre: The manager is locked exclusively.
+    * @post: The station is indexed by name and by the dishes it carries,
+    reports renames and newly carried dishes, and follows the manager's
+    concurrency mode. It is not in the list yet.
+    * @return: False, changing nothing, if the station is nullptr or
+    another station already has its name.
+    */
+    bool adoptStation(KitchenStation* station);
+
+    /**
+    * Looks a station up in the name index.
+    * @param station_name A string representing the station's name.
+    * @return: A pointer to the KitchenStation if found; nullptr
+    otherwise.
+    */
+    KitchenStation* lookupStation(const std::string& station_name) const;
+
+    /**
+    * Looks a station up in the name index.
+    * @param station_name The interned name of the station.
+    * @return: A pointer to the KitchenStation if found; nullptr
+    otherwise.
+    */
+    KitchenStation* lookupStation(Symbol station_name) const;
+
+    /**
+    * Applies the access policy to a station just looked up, without
+    locking.
+    * @param station The station found, or nullptr if there was none.
+    * @post: As findStation, if station is not nullptr.
+    * @return: station.
+    */
+    KitchenStation* hitStation(KitchenStation* station);
+
+    /**
+    * Asks the stations carrying a dish whether they can complete an
+    order for it, on the calling thread or, from the parallel search
+    threshold on, on a pool. The manager's lock is not held across the
+    pool's job: each task holds it while it asks its chunk, and if the
+    floor changed meanwhile the search is run again on this thread.
+    * @param dish_name The interned name of the dish.
+    * @param pool The threads that share the search with this one.
+    * @param able Set to every able station if not nullptr; the search
+    stops at the first one otherwise.
+    * @return: True if an able station was found.
+    */
+    bool searchStations(Symbol dish_name, ThreadPool& pool, std::vector<KitchenStation*>* able) const;
+
+    static constexpr std::size_t PARALLEL_SEARCH_CHUNK = 512; // Stations a thread takes at a time
+
+    /**
+    * @return: A lock on the manager shared with other readers, held
+    only in LOCKED mode.
+    */
+    std::shared_lock<std::shared_mutex> readLock() const;
+
+    /**
+    * @return: A lock on the manager excluding every other thread, held
+    only in LOCKED mode.
+    */
+    std::unique_lock<std::shared_mutex> writeLock() const;
+
+    /**
+    * Locks the manager for a lookup that may record a hit: shared if
+    the access policy is NONE, exclusive otherwise. Holds nothing
+    outside LOCKED mode.
+    * @param reader Set to the shared lock, if taken.
+    * @param writer Set to the exclusive lock, if taken.
+    */
+    void lockForHit(std::shared_lock<std::shared_mutex>& reader, std::unique_lock<std::shared_mutex>& writer) const;
+
+    /**
+    * Locates a station of this manager in the list.
+    * @param station A pointer to a station registered with this manager.
+    * @param previous Set to an iterator to the station before it; end()
+    if it is at the head.
+    * @return: An iterator to the station.
+    */
+    iterator locateStation(const KitchenStation* station, iterator& previous);
+
+    /**
+    * Keeps the name index in step with a station being renamed.
+    * @param station The station, still under its old name.
+    * @param new_name The requested name.
+    * @post: The index maps new_name to the station, unless the name is
+    taken. A station this manager does not index is left alone.
+    * @return: True if the rename may proceed; false if another station
+    has that name.
+    */
+    bool renameStation(const KitchenStation& station, const std::string& new_name);
+
+    /**
+    * Keeps the dish index in step with a dish assigned to a station
+    directly, rather than through the manager, or renamed or changed
+    after its assignment.
+    * @param station The station.
+    * @param dish_name The name it now takes, or no longer takes, orders
+    for.
+    * @param carried Whether the station now takes orders for dish_name.
+    * @post: The station is listed under dish_name if and only if
+    carried. A station this manager does not index is left alone, and so
+    is a dish the manager is assigning itself, which it indexes under the
+    lock it holds.
+    */
+    void indexCarriedDish(const KitchenStation& station, Symbol dish_name, bool carried);
+
+    /**
+    * @return: The manager assigning dishes to its stations on this
+    thread, if any, so that it can tell its own assignments from others
+    when a station reports them.
+    */
+    static const BasicStationManager*& assigningManager();
+
+    /**
+    * Counts a hit on a station and reorganizes the list according to
+    the access policy.
+    * @param previous An iterator to the station before the hit one;
+    end() if the hit station is at the head.
+    * @param hit An iterator to the station that was hit.
+    * @post: The station may have moved. Both iterators are invalidated.
+    */
+    void recordHit(iterator previous, iterator hit);
+
+    /**
+    * Records that a station carries a dish.
+    * @param station A pointer to a station of this manager.
+    * @param dish_name The name the station takes orders for.
+    * @post: The station is listed under dish_name, once.
+    */
+    void indexDish(KitchenStation* station, Symbol dish_name);
+
+    /**
+    * Records that a station no longer carries a dish.
+    * @param station A pointer to a station of this manager.
+    * @param dish_name The name the station stopped taking orders for.
+    * @post: The station is not listed under dish_name. A name left
+    without stations is dropped.
+    */
+    void unindexDish(KitchenStation* station, Symbol dish_name);
+
+    /**
+    * Drops a station that leaves the list from the name index, the dish
+    index and the hit counts.
+    * @param station A pointer to the departing station.
+    * @post: The station is no longer indexed.
+    */
+    void forgetStation(KitchenStation* station);
+
+    // Stations must be added and removed through the StationManager methods, which keep the index in step.
+    // The index yields the station, not its place in the list: iterators into the list backends are invalidated
+    // by the moves every access policy but NONE makes on a hit (a LinkedList iterator holds the node before its
+    // station, a VectorList one an offset), so stored places would have to be rewritten on every hit. Removing
+    // or moving a station by name therefore still calls List::find, which is constant time in HashedStationList.
+    std::unordered_map<Symbol, KitchenStation*> station_index_; // Station name -> station
+    std::unordered_map<Symbol, std::vector<KitchenStation*>> dish_index_; // Dish name -> stations carrying it, unordered
+    std::shared_ptr<BasicStationManager*> listener_token_; // Station listeners act only while they hold the current token
+    AccessPolicy access_policy_; // Reorganization applied on each hit
+    std::size_t parallel_search_threshold_; // Stations carrying a dish from which a search goes to the pool
+    std::size_t floor_changes_; // Bumped whenever the dish index changes, so that a parallel search can tell
+    std::unordered_map<const KitchenStation*, std::size_t> hit_counts_; // Hits per station, for COUNT_ORDERED
+    KitchenStation::ConcurrencyMode concurrency_mode_;
+    mutable std::shared_mutex mutex_; // Guards the list and the indexes; taken before any station's lock
 };
 
+// Stations churn (moved, merged, removed), so their nodes are recycled from a pool
+using StationList = LinkedList<KitchenStation*, PoolNodeAllocator<KitchenStation*>>;
+
+// Several stations per cache line, for floors that are mostly traversed
+using UnrolledStationList = UnrolledList<KitchenStation*>;
+
+// Positional access (getEntry, insert, remove) in O(log n), for floors addressed by index
+using SkipStationList = SkipList<KitchenStation*>;
+
+// One contiguous array, for floors that are mostly traversed and rarely reordered
+using VectorStationList = VectorList<KitchenStation*>;
+
+// Stations located by hashing instead of scanning, for floors that are mostly reordered and removed from
+using HashedStationList = HashedList<KitchenStation*>;
+
+using StationManager = BasicStationManager<StationList>;
+
+#include "StationManager.cpp"
 #endif // STATION_MANAGER_HPP
@@ -0,0 +1,247 @@
+/**
+ * @file Symbol.cpp
+ * @brief This file contains the implementation of the Symbol class and of the global symbol table behind it.
+ *
+ * Each distinct name is kept once, in segments of doubling size that are never moved or freed, and found through an
+ * open-addressing index of pointers to it. Looking a name up reads the index without locking, and reading the name
+ * of an ID reads its segment without locking; interning a new name is serialized by a mutex and publishes the
+ * segment and the name with release stores, so a reader sees either all of it or none of it. When the index fills
+ * up, a larger copy replaces it; the old one is kept for the lookups that may still be reading it.
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#include "Symbol.hpp"
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+/**
+ * An interned name.
+ */
+struct Entry {
+    std::string name;
+    std::size_t hash; // std::hash of the name, compared before the name
+    std::uint32_t id;
+};
+
+/**
+ * An open-addressing hash index over the entries, at most half full.
+ */
+struct Index {
+    std::size_t mask; // Slot count - 1, a power of two minus one
+    std::unique_ptr<std::atomic<const Entry*>[]> slots; // nullptr while free
+
+    explicit Index(std::size_t slot_count) : mask(slot_count - 1), slots(new std::atomic<const Entry*>[slot_count]) {
+        for (std::size_t i = 0; i < slot_count; i++) {
+            slots[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+    * @param name The name to look up.
+    * @param hash std::hash of the name.
+    * @return: Its entry; nullptr if it is not in the index.
+    */
+    const Entry* find(const std::string& name, std::size_t hash) const {
+        for (std::size_t slot = hash & mask;; slot = (slot + 1) & mask) {
+            const Entry* entry = slots[slot].load(std::memory_order_acquire);
+            if (!entry || (entry->hash == hash && entry->name == name)) {
+                return entry;
+            }
+        }
+    }
+
+    /**
+    * @param entry An entry not yet in the index, which has room for it.
+    * @post: Lookups from now on find the entry.
+    */
+    void insert(const Entry* entry) {
+        std::size_t slot = entry->hash & mask;
+        while (slots[slot].load(std::memory_order_relaxed)) {
+            slot = (slot + 1) & mask;
+        }
+        slots[slot].store(entry, std::memory_order_release);
+    }
+};
+
+/**
+ * The names interned so far and the index to find them by.
+ */
+class SymbolTable {
+public:
+    SymbolTable() : size_(0) {
+        for (std::atomic<Entry*>& segment : segments_) {
+            segment.store(nullptr, std::memory_order_relaxed);
+        }
+        indexes_.emplace_back(new Index(64));
+        index_.store(indexes_.back().get(), std::memory_order_release);
+        intern(std::string(), std::hash<std::string>()(std::string()));  // ID 0 is the empty name, the default Symbol
+    }
+
+    /**
+    * @param name The name to look up.
+    * @param hash std::hash of the name.
+    * @return: Its entry; nullptr if it is not interned. Takes no lock.
+    */
+    const Entry* find(const std::string& name, std::size_t hash) const {
+        return index_.load(std::memory_order_acquire)->find(name, hash);
+    }
+
+    /**
+    * @param name The name to intern.
+    * @param hash std::hash of the name.
+    * @return: Its entry, added if it was not interned yet.
+    */
+    const Entry* intern(const std::string& name, std::size_t hash) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Index* index = index_.load(std::memory_order_relaxed);
+        if (const Entry* entry = index->find(name, hash)) {
+            return entry;  // Interned by another thread in the meantime
+        }
+        const std::size_t id = size_.load(std::memory_order_relaxed);
+        if (id > std::numeric_limits<std::uint32_t>::max()) {
+            throw std::length_error("Symbol table is full");
+        }
+        std::size_t offset = 0;
+        const std::size_t segment = locate(id, offset);
+        Entry* entries = segments_[segment].load(std::memory_order_relaxed);
+        if (!entries) {
+            owned_segments_.emplace_back(new Entry[FIRST_SEGMENT << segment]);
+            entries = owned_segments_.back().get();
+            segments_[segment].store(entries, std::memory_order_release);
+        }
+        Entry* added = &entries[offset];
+        *added = Entry{name, hash, static_cast<std::uint32_t>(id)};
+        if ((id + 1) * 2 > index->mask + 1) {
+            indexes_.emplace_back(new Index((index->mask + 1) * 2));
+            index = indexes_.back().get();
+            for (std::size_t other = 0; other <= id; other++) {
+                index->insert(&entry(static_cast<std::uint32_t>(other)));
+            }
+            index_.store(index, std::memory_order_release);
+        } else {
+            index->insert(added);
+        }
+        size_.store(id + 1, std::memory_order_release);
+        return added;
+    }
+
+    /**
+    * @param id The ID of an interned name.
+    * @return: Its entry. Takes no lock: the ID was handed out after its entry was published.
+    */
+    const Entry& entry(std::uint32_t id) const {
+        std::size_t offset = 0;
+        const std::size_t segment = locate(id, offset);
+        return segments_[segment].load(std::memory_order_acquire)[offset];
+    }
+
+    /**
+    * @return: The number of names interned.
+    */
+    std::size_t size() const {
+        return size_.load(std::memory_order_acquire);
+    }
+
+private:
+    static constexpr std::size_t FIRST_SEGMENT = 64; // Entries in segment 0; each later segment is twice the one before
+    static constexpr std::size_t SEGMENTS = 32; // Enough for every 32-bit ID
+
+    /**
+    * @param id An ID.
+    * @param offset Set to the position of its entry within its segment.
+    * @return: The segment holding its entry.
+    */
+    static std::size_t locate(std::size_t id, std::size_t& offset) {
+        // Segment k holds the IDs from FIRST_SEGMENT * (2^k - 1) on, i.e. id + FIRST_SEGMENT in [F * 2^k, F * 2^(k+1))
+        const std::size_t position = id + FIRST_SEGMENT;
+        std::size_t segment = 0;
+        while (position >= (FIRST_SEGMENT << (segment + 1))) {
+            segment++;
+        }
+        offset = position - (FIRST_SEGMENT << segment);
+        return segment;
+    }
+
+    std::atomic<Entry*> segments_[SEGMENTS]; // ID -> entry, by locate; nullptr until needed, then never moved
+    std::vector<std::unique_ptr<Entry[]>> owned_segments_; // Frees the segments with the table
+    std::vector<std::unique_ptr<Index>> indexes_; // Every index published, the last one current
+    std::atomic<Index*> index_; // The current index
+    std::atomic<std::size_t> size_;
+    std::mutex mutex_; // Serializes interning
+};
+
+/**
+ * @return: The global symbol table, built on first use so that symbols can be created during static initialization.
+*/
+SymbolTable& table() {
+    static SymbolTable symbols;
+    return symbols;
+}
+
+} // namespace
+
+/**
+ * Default Constructor
+ * @post: The symbol of the empty name.
+*/
+Symbol::Symbol() : id_(0) {}
+
+/**
+ * Interns a name.
+ * @param name The name to intern.
+ * @post: The name is in the symbol table, under an ID shared by every symbol of that name. Safe to call from several
+threads.
+*/
+Symbol::Symbol(const std::string& name) {
+    SymbolTable& symbols = table();
+    const std::size_t hash = std::hash<std::string>()(name);
+    const Entry* entry = symbols.find(name, hash);
+    id_ = (entry ? entry : symbols.intern(name, hash))->id;
+}
+
+/**
+ * Looks a name up without interning it.
+ * @param name The name to look up.
+ * @param symbol Set to the symbol of the name, if it is interned.
+ * @return: True if the name is interned; false if no symbol of that name was ever created, so nothing can carry it.
+*/
+bool Symbol::find(const std::string& name, Symbol& symbol) {
+    const Entry* entry = table().find(name, std::hash<std::string>()(name));
+    if (!entry) {
+        return false;
+    }
+    symbol.id_ = entry->id;
+    return true;
+}
+
+/**
+ * @return: The name, for display. The reference stays valid for the life of the program.
+*/
+const std::string& Symbol::str() const {
+    return table().entry(id_).name;
+}
+
+/**
+ * @return: The number of distinct names interned so far.
+*/
+std::size_t Symbol::tableSize() {
+    return table().size();
+}
+
+/**
+ * Writes the name of a symbol.
+ * @param out The stream to write to.
+ * @param symbol The symbol to write.
+ * @return: out.
+*/
+std::ostream& operator<<(std::ostream& out, const Symbol& symbol) {
+    return out << symbol.str();
+}
@@ -0,0 +1,138 @@
+/**
+ * @file Symbol.hpp
+ * @brief This file contains the declaration of the Symbol class, an interned name in the virtual bistro simulation.
+ *
+ * Dish, ingredient and station names are interned once in a global symbol table, which hands out a 32-bit ID per
+ * distinct name. Symbols compare and hash by ID; the name itself is kept once in the table, for display.
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#ifndef SYMBOL_HPP
+#define SYMBOL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+
+class Symbol {
+public:
+    /**
+    * Default Constructor
+    * @post: The symbol of the empty name.
+    */
+    Symbol();
+
+    /**
+    * Interns a name.
+    * @param name The name to intern.
+    * @post: The name is in the symbol table, under an ID shared by every
+    symbol of that name. Safe to call from several threads.
+    */
+    explicit Symbol(const std::string& name);
+
+    /**
+    * Looks a name up without interning it.
+    * @param name The name to look up.
+    * @param symbol Set to the symbol of the name, if it is interned.
+    * @return: True if the name is interned; false if no symbol of that
+    name was ever created, so nothing can carry it.
+    */
+    static bool find(const std::string& name, Symbol& symbol);
+
+    /**
+    * @return: The name, for display. The reference stays valid for the
+    life of the program.
+    */
+    const std::string& str() const;
+
+    /**
+    * @return: The ID of the name, unique among interned names.
+    */
+    std::uint32_t id() const { return id_; }
+
+    /**
+    * @return: The name, so a symbol can be used where a string is read.
+    */
+    operator const std::string&() const { return str(); }
+
+    /**
+    * Interns a name in place of the current one.
+    * @param name The new name.
+    * @return: The symbol, so that a name field can be assigned a string.
+    */
+    Symbol& operator=(const std::string& name) { return *this = Symbol(name); }
+    Symbol& operator=(const char* name) { return *this = Symbol(std::string(name)); }
+
+    /**
+    * Appends to the name and interns the result.
+    * @param suffix The text to append.
+    * @return: The symbol.
+    */
+    Symbol& operator+=(const std::string& suffix) { return *this = str() + suffix; }
+
+    // The read-only std::string accessors, so a symbol reads like the string it replaced
+    std::size_t size() const { return str().size(); }
+    std::size_t length() const { return str().length(); }
+    bool empty() const { return str().empty(); }
+    const char* c_str() const { return str().c_str(); }
+    const char* data() const { return str().data(); }
+    const char& operator[](std::size_t pos) const { return str()[pos]; }
+    std::string::const_iterator begin() const { return str().begin(); }
+    std::string::const_iterator end() const { return str().end(); }
+    std::string substr(std::size_t pos = 0, std::size_t count = std::string::npos) const {
+        return str().substr(pos, count);
+    }
+    std::size_t find(const std::string& text, std::size_t pos = 0) const { return str().find(text, pos); }
+    int compare(const std::string& text) const { return str().compare(text); }
+
+    /**
+    * @return: The number of distinct names interned so far.
+    */
+    static std::size_t tableSize();
+
+    bool operator==(const Symbol& rhs) const { return id_ == rhs.id_; }
+    bool operator!=(const Symbol& rhs) const { return id_ != rhs.id_; }
+    bool operator<(const Symbol& rhs) const { return id_ < rhs.id_; } // Interning order, not alphabetical
+
+    // Against a plain string the names are compared, so code reading a name as a string keeps working
+    friend bool operator==(const Symbol& lhs, const std::string& rhs) { return lhs.str() == rhs; }
+    friend bool operator==(const std::string& lhs, const Symbol& rhs) { return lhs == rhs.str(); }
+    friend bool operator!=(const Symbol& lhs, const std::string& rhs) { return lhs.str() != rhs; }
+    friend bool operator!=(const std::string& lhs, const Symbol& rhs) { return lhs != rhs.str(); }
+    friend bool operator==(const Symbol& lhs, const char* rhs) { return lhs.str() == rhs; }
+    friend bool operator==(const char* lhs, const Symbol& rhs) { return lhs == rhs.str(); }
+    friend bool operator!=(const Symbol& lhs, const char* rhs) { return lhs.str() != rhs; }
+    friend bool operator!=(const char* lhs, const Symbol& rhs) { return lhs != rhs.str(); }
+
+    // Concatenating yields a plain string, as it did when names were strings
+    friend std::string operator+(const Symbol& lhs, const std::string& rhs) { return lhs.str() + rhs; }
+    friend std::string operator+(const std::string& lhs, const Symbol& rhs) { return lhs + rhs.str(); }
+    friend std::string operator+(const Symbol& lhs, const char* rhs) { return lhs.str() + rhs; }
+    friend std::string operator+(const char* lhs, const Symbol& rhs) { return lhs + rhs.str(); }
+    friend std::string operator+(const Symbol& lhs, char rhs) { return lhs.str() + rhs; }
+
+private:
+    std::uint32_t id_;
+};
+
+/**
+ * Writes the name of a symbol.
+ * @param out The stream to write to.
+ * @param symbol The symbol to write.
+ * @return: out.
+ */
+std::ostream& operator<<(std::ostream& out, const Symbol& symbol);
+
+namespace std {
+    // IDs are already unique, so they hash to themselves
+    template<>
+    struct hash<Symbol> {
+        std::size_t operator()(const Symbol& symbol) const { return symbol.id(); }
+    };
+}
+
+#endif // SYMBOL_HPP
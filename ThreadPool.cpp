@@ -0,0 +1,119 @@
+/**
+ * @file ThreadPool.cpp
+ * @brief This file contains the implementation of the ThreadPool class, a set of threads that split a job among them in the virtual bistro simulation.
+ *
+ * Every pool thread takes part in every job, even when the tasks are all taken by the time it wakes, so the caller
+ * only has to wait for the count of busy threads to reach zero: no thread can still be reading a job once run returns.
+ * The tasks are handed out by one atomic counter, so a thread that finishes its task early takes the next one.
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#include "ThreadPool.hpp"
+
+namespace {
+
+thread_local bool t_in_pool_task = false; // Set while a thread runs a task, so that a nested run stays on it
+
+} // namespace
+
+/**
+ * Parameterized Constructor
+ * @param thread_count The number of threads besides the callers of run; 0 makes every job run on its caller.
+ * @post: Starts the threads, which sleep until there is a job.
+*/
+ThreadPool::ThreadPool(std::size_t thread_count)
+    : task_(nullptr), task_count_(0), next_task_(0), generation_(0), busy_(0), stopping_(false) {
+    for (std::size_t i = 0; i < thread_count; i++) {
+        threads_.emplace_back([this] { runThread(); });
+    }
+}
+
+/**
+ * Destructor
+ * @pre: No job is running.
+ * @post: Stops and joins the threads.
+*/
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    job_started_.notify_all();
+    for (std::thread& thread : threads_) {
+        thread.join();
+    }
+}
+
+/**
+ * Runs a job on the pool and the calling thread.
+ * @param task_count The number of tasks.
+ * @param task Called once for each index in [0, task_count), on any of the threads and in any order. It must not
+throw.
+ * @post: Every task is done. If the pool was running another job, or is called from one of its own tasks, the tasks
+ran on this thread alone.
+*/
+void ThreadPool::run(std::size_t task_count, const Task& task) {
+    std::unique_lock<std::mutex> job_lock(job_mutex_, std::defer_lock);
+    if (threads_.empty() || task_count <= 1 || t_in_pool_task || !job_lock.try_lock()) {
+        for (std::size_t i = 0; i < task_count; i++) {
+            task(i);
+        }
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &task;
+        task_count_ = task_count;
+        next_task_.store(0, std::memory_order_relaxed);
+        generation_++;
+        busy_ = threads_.size();
+    }
+    job_started_.notify_all();
+    work();
+    std::unique_lock<std::mutex> lock(mutex_);
+    job_finished_.wait(lock, [this] { return busy_ == 0; });
+    task_ = nullptr;
+}
+
+/**
+ * @return: The number of threads besides the callers of run.
+*/
+std::size_t ThreadPool::getThreadCount() const {
+    return threads_.size();
+}
+
+/**
+ * Works on each job as it comes, until the pool is destroyed.
+*/
+void ThreadPool::runThread() {
+    std::size_t generation = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            job_started_.wait(lock, [&] { return stopping_ || generation_ != generation; });
+            if (stopping_) {
+                return;
+            }
+            generation = generation_;
+        }
+        work();
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--busy_ == 0) {
+            job_finished_.notify_one();
+        }
+    }
+}
+
+/**
+ * Takes and runs tasks of the current job until none is left.
+*/
+void ThreadPool::work() {
+    t_in_pool_task = true;
+    for (std::size_t i = next_task_.fetch_add(1, std::memory_order_relaxed); i < task_count_;
+         i = next_task_.fetch_add(1, std::memory_order_relaxed)) {
+        (*task_)(i);
+    }
+    t_in_pool_task = false;
+}
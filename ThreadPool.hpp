@@ -0,0 +1,86 @@
+/**
+ * @file ThreadPool.hpp
+ * @brief This file contains the declaration of the ThreadPool class, a set of threads that split a job among them in the virtual bistro simulation.
+ *
+ * A job is a number of tasks, identified by index. The caller of run works on the job alongside the pool threads,
+ * each taking the next task not yet taken, and returns once every task is done. The pool runs one job at a time; a
+ * caller that finds it busy runs its job alone, rather than wait for it.
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+public:
+    using Task = std::function<void(std::size_t)>;
+
+    /**
+    * Parameterized Constructor
+    * @param thread_count The number of threads besides the callers of
+    run; 0 makes every job run on its caller.
+    * @post: Starts the threads, which sleep until there is a job.
+    */
+    explicit ThreadPool(std::size_t thread_count);
+
+    /**
+    * Destructor
+    * @pre: No job is running.
+    * @post: Stops and joins the threads.
+    */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool& other) = delete;
+    ThreadPool& operator=(const ThreadPool& other) = delete;
+
+    /**
+    * Runs a job on the pool and the calling thread.
+    * @param task_count The number of tasks.
+    * @param task Called once for each index in [0, task_count), on any
+    of the threads and in any order. It must not throw.
+    * @post: Every task is done. If the pool was running another job, or
+    is called from one of its own tasks, the tasks ran on this thread
+    alone.
+    */
+    void run(std::size_t task_count, const Task& task);
+
+    /**
+    * @return: The number of threads besides the callers of run.
+    */
+    std::size_t getThreadCount() const;
+
+private:
+    /**
+    * Works on each job as it comes, until the pool is destroyed.
+    */
+    void runThread();
+
+    /**
+    * Takes and runs tasks of the current job until none is left.
+    */
+    void work();
+
+    std::vector<std::thread> threads_;
+    std::mutex job_mutex_; // Held by the caller of run for the whole job
+    std::mutex mutex_; // Guards the fields below, but next_task_
+    std::condition_variable job_started_;
+    std::condition_variable job_finished_;
+    const Task* task_; // The current job
+    std::size_t task_count_;
+    std::atomic<std::size_t> next_task_;
+    std::size_t generation_; // Bumped for each job, so that a thread takes part in it once
+    std::size_t busy_; // Pool threads not yet done with the current job
+    bool stopping_;
+};
+
+#endif // THREAD_POOL_HPP
@@ -0,0 +1,508 @@
+/** ADT list: unrolled (chunked) singly linked list implementation.
+
+ Implementation file for the class UnrolledList.
+ @file UnrolledList.cpp */
+
+#include "UnrolledList.hpp"  // Header file
+#include <algorithm>
+#include <cassert>
+#include <new>
+#include <string>
+#include <utility>
+
+// constructor
+template<class T, std::size_t BLOCK_BYTES>
+UnrolledList<T, BLOCK_BYTES>::UnrolledList() : head_ptr_(nullptr), tail_ptr_(nullptr), item_count_(0)
+{
+}  // end default constructor
+
+
+// copy constructor: entries are packed into full blocks
+template<class T, std::size_t BLOCK_BYTES>
+UnrolledList<T, BLOCK_BYTES>::UnrolledList(const UnrolledList<T, BLOCK_BYTES>& a_list) :
+      head_ptr_(nullptr), tail_ptr_(nullptr), item_count_(0)
+{
+   for (const T& entry : a_list)
+      pushBack(entry);
+}  // end copy constructor
+
+
+// move constructor: takes over the chain of a_list, which is left empty
+template<class T, std::size_t BLOCK_BYTES>
+UnrolledList<T, BLOCK_BYTES>::UnrolledList(UnrolledList<T, BLOCK_BYTES>&& a_list) noexcept :
+      head_ptr_(std::exchange(a_list.head_ptr_, nullptr)),
+      tail_ptr_(std::exchange(a_list.tail_ptr_, nullptr)),
+      item_count_(std::exchange(a_list.item_count_, 0))
+{
+}  // end move constructor
+
+
+// copy assignment
+template<class T, std::size_t BLOCK_BYTES>
+UnrolledList<T, BLOCK_BYTES>& UnrolledList<T, BLOCK_BYTES>::operator=(const UnrolledList<T, BLOCK_BYTES>& a_list)
+{
+   if (this != &a_list)
+      *this = UnrolledList<T, BLOCK_BYTES>(a_list);
+   return *this;
+}  // end copy assignment
+
+
+// move assignment: releases the current chain and takes over the chain of a_list
+template<class T, std::size_t BLOCK_BYTES>
+UnrolledList<T, BLOCK_BYTES>& UnrolledList<T, BLOCK_BYTES>::operator=(UnrolledList<T, BLOCK_BYTES>&& a_list) noexcept
+{
+   if (this != &a_list)
+   {
+      clear();
+      head_ptr_ = std::exchange(a_list.head_ptr_, nullptr);
+      tail_ptr_ = std::exchange(a_list.tail_ptr_, nullptr);
+      item_count_ = std::exchange(a_list.item_count_, 0);
+   }
+   return *this;
+}  // end move assignment
+
+
+// destructor
+template<class T, std::size_t BLOCK_BYTES>
+UnrolledList<T, BLOCK_BYTES>::~UnrolledList()
+{
+   clear();
+}  // end destructor
+
+
+
+/**@return true if list is empty - item_count_ == 0 */
+template<class T, std::size_t BLOCK_BYTES>
+bool UnrolledList<T, BLOCK_BYTES>::isEmpty() const
+{
+   return item_count_ == 0;
+}  // end isEmpty
+
+
+/**@return the number of items in the list - item_count_ */
+template<class T, std::size_t BLOCK_BYTES>
+int UnrolledList<T, BLOCK_BYTES>::getLength() const
+{
+   return item_count_;
+}  // end getLength
+
+
+
+/**
+ @pre list positions follow traditional indexing from 0 to item_count_ -1
+ @param position indicating point of insertion
+ @param new_entry to be inserted in list
+ @post new_entry is added at position in list (the entry previously at that position is now at position+1)
+ @return true if valid position (0 <= position <= item_count_) */
+template<class T, std::size_t BLOCK_BYTES>
+bool UnrolledList<T, BLOCK_BYTES>::insert(int position, const T& new_entry)
+{
+   return emplace(position, new_entry);
+}  // end insert
+
+template<class T, std::size_t BLOCK_BYTES>
+bool UnrolledList<T, BLOCK_BYTES>::insert(int position, T&& new_entry)
+{
+   return emplace(position, std::move(new_entry));
+}  // end insert
+
+
+
+/**
+ @pre list positions follow traditional indexing from 0 to item_count_ -1
+ @param position indicating point of insertion
+ @param args forwarded to the constructor of T
+ @post an entry constructed in place from args is added at position in list
+ @return true if valid position (0 <= position <= item_count_) */
+template<class T, std::size_t BLOCK_BYTES>
+template<class... Args>
+bool UnrolledList<T, BLOCK_BYTES>::emplace(int position, Args&&... args)
+{
+   bool able_to_insert = (position >= 0) && (position <= item_count_);
+   if (able_to_insert)
+   {
+      T* slot = nullptr;
+      if (position == item_count_ && (tail_ptr_ == nullptr || tail_ptr_->count_ == Block::CAPACITY))
+      {
+         // Start a new block at the end of the chain
+         Block* new_block_ptr = new Block();
+         if (tail_ptr_ == nullptr)
+            head_ptr_ = new_block_ptr;
+         else
+            tail_ptr_->next_ = new_block_ptr;
+         tail_ptr_ = new_block_ptr;
+         new_block_ptr->count_ = 1;
+         slot = new_block_ptr->items();
+      }
+      else if (position == 0 && head_ptr_->count_ == Block::CAPACITY)
+      {
+         // Start a new block at the beginning of the chain instead of splitting the head
+         Block* new_block_ptr = new Block();
+         new_block_ptr->next_ = head_ptr_;
+         head_ptr_ = new_block_ptr;
+         new_block_ptr->count_ = 1;
+         slot = new_block_ptr->items();
+      }
+      else
+      {
+         std::size_t index = 0;
+         Block* prev_block = nullptr;
+         Block* block = locate(position, index, prev_block);
+         slot = openSlot(block, index);
+      }  // end if
+
+      new (slot) T(std::forward<Args>(args)...);
+      item_count_++;  // Increase count of entries
+   }  // end if
+
+   return able_to_insert;
+}  // end emplace
+
+
+/**
+ @param new_entry to be inserted in list
+ @post new_entry is added at the end of the list, in constant time */
+template<class T, std::size_t BLOCK_BYTES>
+void UnrolledList<T, BLOCK_BYTES>::pushBack(const T& new_entry)
+{
+   emplace(item_count_, new_entry);
+}  // end pushBack
+
+template<class T, std::size_t BLOCK_BYTES>
+void UnrolledList<T, BLOCK_BYTES>::pushBack(T&& new_entry)
+{
+   emplace(item_count_, std::move(new_entry));
+}  // end pushBack
+
+
+/**
+ @param new_entry to be inserted in list
+ @post new_entry is added at the beginning of the list, in O(CAPACITY) time */
+template<class T, std::size_t BLOCK_BYTES>
+void UnrolledList<T, BLOCK_BYTES>::pushFront(const T& new_entry)
+{
+   emplace(0, new_entry);
+}  // end pushFront
+
+template<class T, std::size_t BLOCK_BYTES>
+void UnrolledList<T, BLOCK_BYTES>::pushFront(T&& new_entry)
+{
+   emplace(0, std::move(new_entry));
+}  // end pushFront
+
+
+
+/**
+ @pre list positions follow traditional indexing from 0 to item_count_ -1
+ @param position indicating point of deletion
+ @post entry at position is deleted, if any. List order is retained
+ @return true if there is an entry at position to be deleted, false otherwise */
+template<class T, std::size_t BLOCK_BYTES>
+bool UnrolledList<T, BLOCK_BYTES>::remove(int position)
+{
+   bool able_to_remove = (position >= 0) && (position < item_count_);
+   if (able_to_remove)
+   {
+      std::size_t index = 0;
+      Block* prev_block = nullptr;
+      Block* block = locate(position, index, prev_block);
+      removeAt(prev_block, block, index);
+   }  // end if
+
+   return able_to_remove;
+}  // end remove
+
+
+
+/**@post the list is empty and item_count_ == 0*/
+template<class T, std::size_t BLOCK_BYTES>
+void UnrolledList<T, BLOCK_BYTES>::clear()
+{
+   while (head_ptr_ != nullptr)
+   {
+      Block* block = head_ptr_;
+      head_ptr_ = block->next_;
+      for (std::size_t i = 0; i < block->count_; i++)
+         block->items()[i].~T();
+      delete block;
+   }  // end while
+   tail_ptr_ = nullptr;
+   item_count_ = 0;
+}  // end clear
+
+
+
+/**
+ @pre list positions follow traditional indexing from 0 to item_count_ -1
+ @param position indicating the position of the data to be retrieved
+ @return reference to the data item found at position. If position is not a valid position < item_count_
+ throws  PrecondViolatedExcep */
+template<class T, std::size_t BLOCK_BYTES>
+const T& UnrolledList<T, BLOCK_BYTES>::getEntry(int position) const
+{
+   // Enforce precondition
+   bool ableToGet = (position >= 0) && (position < item_count_);
+   if (ableToGet)
+   {
+      std::size_t index = 0;
+      Block* prev_block = nullptr;
+      return locate(position, index, prev_block)->getItem(index);
+   }
+   else
+   {
+      std::string message = "getEntry() called with an empty list or ";
+      message  = message + "invalid position.";
+      throw(PrecondViolatedExcep(message));
+   }  // end if
+}  // end getEntry
+
+
+/**@return the first block of the chain, nullptr if the list is empty */
+template<class T, std::size_t BLOCK_BYTES>
+const typename UnrolledList<T, BLOCK_BYTES>::Block* UnrolledList<T, BLOCK_BYTES>::getHeadBlock() const
+{
+   return head_ptr_;
+}  // end getHeadBlock
+
+
+/**@return iterator to the first entry, equal to end() if the list is empty */
+template<class T, std::size_t BLOCK_BYTES>
+typename UnrolledList<T, BLOCK_BYTES>::iterator UnrolledList<T, BLOCK_BYTES>::begin()
+{
+   return iterator(nullptr, head_ptr_, 0);
+}  // end begin
+
+template<class T, std::size_t BLOCK_BYTES>
+typename UnrolledList<T, BLOCK_BYTES>::const_iterator UnrolledList<T, BLOCK_BYTES>::begin() const
+{
+   return const_iterator(nullptr, head_ptr_, 0);
+}  // end begin
+
+template<class T, std::size_t BLOCK_BYTES>
+typename UnrolledList<T, BLOCK_BYTES>::const_iterator UnrolledList<T, BLOCK_BYTES>::cbegin() const
+{
+   return begin();
+}  // end cbegin
+
+
+/**@return iterator one past the last entry */
+template<class T, std::size_t BLOCK_BYTES>
+typename UnrolledList<T, BLOCK_BYTES>::iterator UnrolledList<T, BLOCK_BYTES>::end()
+{
+   return iterator(tail_ptr_, nullptr, 0);
+}  // end end
+
+template<class T, std::size_t BLOCK_BYTES>
+typename UnrolledList<T, BLOCK_BYTES>::const_iterator UnrolledList<T, BLOCK_BYTES>::end() const
+{
+   return const_iterator(tail_ptr_, nullptr, 0);
+}  // end end
+
+template<class T, std::size_t BLOCK_BYTES>
+typename UnrolledList<T, BLOCK_BYTES>::const_iterator UnrolledList<T, BLOCK_BYTES>::cend() const
+{
+   return end();
+}  // end cend
+
+
+/**
+ @param entry to be searched for
+ @return iterator to the first entry equal to entry, end() if there is none. Linear time */
+template<class T, std::size_t BLOCK_BYTES>
+typename UnrolledList<T, BLOCK_BYTES>::iterator UnrolledList<T, BLOCK_BYTES>::find(const T& entry)
+{
+   return std::find(begin(), end(), entry);
+}  // end find
+
+
+template<class T, std::size_t BLOCK_BYTES>
+typename UnrolledList<T, BLOCK_BYTES>::const_iterator UnrolledList<T, BLOCK_BYTES>::find(const T& entry) const
+{
+   return std::find(begin(), end(), entry);
+}  // end find
+
+
+/**
+ @pre position refers to an entry of this list (it is not end())
+ @param position iterator to the entry to be deleted
+ @post the entry is deleted in O(CAPACITY) time. Iterators into the
+       entry's block and the block after it are invalidated
+ @return iterator to the entry that followed the deleted one */
+template<class T, std::size_t BLOCK_BYTES>
+typename UnrolledList<T, BLOCK_BYTES>::iterator UnrolledList<T, BLOCK_BYTES>::erase(iterator position)
+{
+   assert(position.block_ != nullptr);
+   return removeAt(position.prev_block_, position.block_, position.index_);
+}  // end erase
+
+
+/**
+ @pre position refers to an entry of this list (it is not end())
+ @param position iterator to the entry to be moved
+ @post the entry is moved to the head of the list in O(CAPACITY) time.
+       Other iterators are invalidated
+ @return iterator to the moved entry, now equal to begin() */
+template<class T, std::size_t BLOCK_BYTES>
+typename UnrolledList<T, BLOCK_BYTES>::iterator UnrolledList<T, BLOCK_BYTES>::moveToFront(iterator position)
+{
+   if (position != begin())
+   {
+      T entry(std::move(*position));
+      erase(position);
+      emplace(0, std::move(entry));
+   }  // end if
+   return begin();
+}  // end moveToFront
+
+
+/**
+ @pre position and source refer to entries of this list, position before source
+ @param position iterator to the entry after which to move
+ @param source iterator to the entry to be moved
+ @post the entry of source is moved right after position; the entries in
+       between shift back by one. Other iterators are invalidated
+ @return iterator to the moved entry */
+template<class T, std::size_t BLOCK_BYTES>
+typename UnrolledList<T, BLOCK_BYTES>::iterator UnrolledList<T, BLOCK_BYTES>::spliceAfter(iterator position, iterator source)
+{
+   if (position == source)
+      return source;
+
+   iterator target = position;
+   ++target;
+   iterator after_source = source;
+   ++after_source;
+   std::rotate(target, source, after_source);  // Entries move, blocks stay as they are
+   return target;
+}  // end spliceAfter
+
+
+
+/************* PRIVATE METHODS ************/
+
+
+// Locates the block that holds a position.
+// @pre 0 <= position <= item_count_
+// @param position the index of the desired entry
+// @param index set to the index of the entry within the returned block
+// @param prev_block set to the block before the returned one
+// @return the block holding the position; for position == item_count_ the tail block
+template<class T, std::size_t BLOCK_BYTES>
+typename UnrolledList<T, BLOCK_BYTES>::Block* UnrolledList<T, BLOCK_BYTES>::locate(int position, std::size_t& index, Block*& prev_block) const
+{
+   // Skip whole blocks from the beginning of the chain
+   prev_block = nullptr;
+   Block* block = head_ptr_;
+   std::size_t remaining = static_cast<std::size_t>(position);
+   while (remaining >= block->count_ && block->next_ != nullptr)
+   {
+      remaining -= block->count_;
+      prev_block = block;
+      block = block->next_;
+   }  // end while
+
+   index = remaining;
+   return block;
+}  // end locate
+
+
+// Makes room for one entry at index of block, splitting the block when it is full.
+// @param block the block receiving the entry
+// @param index position within block, 0 <= index <= block->count_
+// @return the slot where the new entry must be constructed
+template<class T, std::size_t BLOCK_BYTES>
+T* UnrolledList<T, BLOCK_BYTES>::openSlot(Block* block, std::size_t index)
+{
+   if (block->count_ == Block::CAPACITY)
+   {
+      // Split: the upper half of the entries moves to a new block linked after this one
+      Block* new_block_ptr = new Block();
+      new_block_ptr->next_ = block->next_;
+      block->next_ = new_block_ptr;
+      if (tail_ptr_ == block)
+         tail_ptr_ = new_block_ptr;
+
+      std::size_t keep = (Block::CAPACITY + 1) / 2;
+      T* items = block->items();
+      for (std::size_t i = keep; i < Block::CAPACITY; i++)
+      {
+         new (new_block_ptr->items() + (i - keep)) T(std::move(items[i]));
+         items[i].~T();
+      }  // end for
+      new_block_ptr->count_ = Block::CAPACITY - keep;
+      block->count_ = keep;
+
+      if (index > keep)
+      {
+         block = new_block_ptr;
+         index -= keep;
+      }  // end if
+   }  // end if
+
+   // Shift the entries at and after index up by one
+   T* items = block->items();
+   std::size_t count = block->count_;
+   if (index < count)
+   {
+      new (items + count) T(std::move(items[count - 1]));
+      for (std::size_t i = count - 1; i > index; i--)
+         items[i] = std::move(items[i - 1]);
+      items[index].~T();
+   }  // end if
+   block->count_++;
+
+   return items + index;
+}  // end openSlot
+
+
+// Removes the entry at index of block and unlinks or merges the block as needed.
+// @return iterator to the entry that followed the removed one
+template<class T, std::size_t BLOCK_BYTES>
+typename UnrolledList<T, BLOCK_BYTES>::iterator UnrolledList<T, BLOCK_BYTES>::removeAt(Block* prev_block, Block* block, std::size_t index)
+{
+   // Shift the entries after index down by one
+   T* items = block->items();
+   for (std::size_t i = index; i + 1 < block->count_; i++)
+      items[i] = std::move(items[i + 1]);
+   items[block->count_ - 1].~T();
+   block->count_--;
+   item_count_--;
+
+   Block* next_block = block->next_;
+   if (block->count_ == 0)
+   {
+      // Unlink the empty block
+      if (prev_block == nullptr)
+         head_ptr_ = next_block;
+      else
+         prev_block->next_ = next_block;
+      if (tail_ptr_ == block)
+         tail_ptr_ = prev_block;
+      delete block;
+      return iterator(prev_block, next_block, 0);
+   }  // end if
+
+   // Keep blocks at least half full by pulling in the next block when it fits
+   if (next_block != nullptr && block->count_ < Block::CAPACITY / 2
+       && block->count_ + next_block->count_ <= Block::CAPACITY)
+   {
+      T* next_items = next_block->items();
+      for (std::size_t i = 0; i < next_block->count_; i++)
+      {
+         new (items + block->count_ + i) T(std::move(next_items[i]));
+         next_items[i].~T();
+      }  // end for
+      block->count_ += next_block->count_;
+      block->next_ = next_block->next_;
+      if (tail_ptr_ == next_block)
+         tail_ptr_ = block;
+      delete next_block;
+   }  // end if
+
+   if (index < block->count_)
+      return iterator(prev_block, block, index);
+   return iterator(block, block->next_, 0);
+}  // end removeAt
+
+
+//  End of implementation file.
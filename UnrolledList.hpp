@@ -0,0 +1,252 @@
+/** ADT list: unrolled (chunked) singly linked list implementation.
+    Every block holds several entries and is aligned to a cache line, so a
+    traversal touches one cache line per block instead of one per entry.
+    The interface mirrors LinkedList, so the two can be swapped at compile time.
+    @file UnrolledList.hpp */
+
+#ifndef UNROLLED_LIST_
+#define UNROLLED_LIST_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include "PrecondViolatedExcep.hpp"
+
+/** @param T type of the entries
+    @param BLOCK_BYTES size of one block, a multiple of the cache line size */
+template<class T, std::size_t BLOCK_BYTES = 128>
+class UnrolledList
+{
+public:
+   static constexpr std::size_t CACHE_LINE = 64;
+
+   /** A block of the chain: a count, a link and up to CAPACITY entries */
+   class alignas(CACHE_LINE) Block
+   {
+   public:
+      static constexpr std::size_t HEADER_BYTES = sizeof(void*) + sizeof(std::size_t);
+      // at least two entries, so that splitting a full block leaves room in both halves
+      static constexpr std::size_t CAPACITY =
+            (BLOCK_BYTES >= HEADER_BYTES + 2 * sizeof(T)) ? (BLOCK_BYTES - HEADER_BYTES) / sizeof(T) : 2;
+
+      /**@return the number of entries held by the block */
+      std::size_t getCount() const { return count_; }
+
+      /**@return the next block in the chain, nullptr for the last one */
+      Block* getNext() const { return next_; }
+
+      /**@pre index < getCount()
+         @return the entry at index within the block */
+      T& getItem(std::size_t index) { return items()[index]; }
+      const T& getItem(std::size_t index) const { return items()[index]; }
+
+   private:
+      friend class UnrolledList<T, BLOCK_BYTES>;
+
+      Block() : next_(nullptr), count_(0) {}
+
+      T* items() { return reinterpret_cast<T*>(storage_); }
+      const T* items() const { return reinterpret_cast<const T*>(storage_); }
+
+      Block* next_;
+      std::size_t count_;
+      alignas(T) unsigned char storage_[CAPACITY * sizeof(T)];
+   }; // end Block
+
+   /** Forward iterator over the entries of the list.
+       It remembers the block before its current one so that erase(it) can
+       unlink a block that becomes empty.
+       @param IsConst true for const_iterator, false for iterator */
+   template<bool IsConst>
+   class ListIterator
+   {
+   public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = T;
+      using difference_type = std::ptrdiff_t;
+      using pointer = std::conditional_t<IsConst, const T*, T*>;
+      using reference = std::conditional_t<IsConst, const T&, T&>;
+
+      ListIterator() : prev_block_(nullptr), block_(nullptr), index_(0) {}
+
+      // an iterator converts to a const_iterator, never the other way around
+      template<bool WasConst, class = std::enable_if_t<IsConst && !WasConst>>
+      ListIterator(const ListIterator<WasConst>& other) :
+            prev_block_(other.prev_block_), block_(other.block_), index_(other.index_) {}
+
+      reference operator*() const { return block_->getItem(index_); }
+      pointer operator->() const { return &block_->getItem(index_); }
+
+      ListIterator& operator++()
+      {
+         if (++index_ == block_->getCount())
+         {
+            prev_block_ = block_;
+            block_ = block_->getNext();
+            index_ = 0;
+         }
+         return *this;
+      }
+
+      ListIterator operator++(int)
+      {
+         ListIterator old = *this;
+         ++(*this);
+         return old;
+      }
+
+      friend bool operator==(const ListIterator& lhs, const ListIterator& rhs)
+      {
+         return lhs.block_ == rhs.block_ && lhs.index_ == rhs.index_;
+      }
+
+      friend bool operator!=(const ListIterator& lhs, const ListIterator& rhs)
+      {
+         return !(lhs == rhs);
+      }
+
+   private:
+      friend class UnrolledList<T, BLOCK_BYTES>;
+      template<bool> friend class ListIterator;
+
+      ListIterator(Block* prev_block, Block* block, std::size_t index) :
+            prev_block_(prev_block), block_(block), index_(index) {}
+
+      Block* prev_block_; // block before block_, nullptr at the head
+      Block* block_;      // current block, nullptr past the end
+      std::size_t index_; // entry within block_
+   }; // end ListIterator
+
+   using iterator = ListIterator<false>;
+   using const_iterator = ListIterator<true>;
+
+   UnrolledList(); // constructor
+   UnrolledList(const UnrolledList<T, BLOCK_BYTES>& a_list); // copy constructor
+   UnrolledList(UnrolledList<T, BLOCK_BYTES>&& a_list) noexcept; // move constructor, a_list is left empty
+   UnrolledList<T, BLOCK_BYTES>& operator=(const UnrolledList<T, BLOCK_BYTES>& a_list); // copy assignment
+   UnrolledList<T, BLOCK_BYTES>& operator=(UnrolledList<T, BLOCK_BYTES>&& a_list) noexcept; // move assignment
+   virtual ~UnrolledList(); // destructor
+
+   /**@return true if list is empty - item_count_ == 0 */
+   bool isEmpty() const;
+
+   /**@return the number of items in the list - item_count_ */
+   int getLength() const;
+
+    /**
+     @pre list positions follow traditional indexing from 0 to item_count_ -1
+     @param position indicating point of insertion
+     @param new_entry to be inserted in list
+     @post new_entry is added at position in list (the entry previously at that position is now at position+1)
+     @return true if valid position (0 <= position <= item_count_) */
+   bool insert(int position, const T& new_entry);
+   bool insert(int position, T&& new_entry);
+
+    /**
+     @pre list positions follow traditional indexing from 0 to item_count_ -1
+     @param position indicating point of insertion
+     @param args forwarded to the constructor of T
+     @post an entry constructed in place from args is added at position in list
+     @return true if valid position (0 <= position <= item_count_) */
+   template<class... Args>
+   bool emplace(int position, Args&&... args);
+
+    /**
+     @param new_entry to be inserted in list
+     @post new_entry is added at the end of the list, in constant time */
+   void pushBack(const T& new_entry);
+   void pushBack(T&& new_entry);
+
+    /**
+     @param new_entry to be inserted in list
+     @post new_entry is added at the beginning of the list, in O(CAPACITY) time */
+   void pushFront(const T& new_entry);
+   void pushFront(T&& new_entry);
+
+    /**
+     @pre list positions follow traditional indexing from 0 to item_count_ -1
+     @param position indicating point of deletion
+     @post entry at position is deleted, if any. List order is retained
+     @return true if there is an entry at position to be deleted, false otherwise */
+   bool remove(int position);
+
+   /**@post the list is empty and item_count_ == 0*/
+   void clear();
+
+    /**
+     @pre list positions follow traditional indexing from 0 to item_count_ -1
+     @param position indicating the position of the data to be retrieved
+     @return reference to the data item found at position. If position is not a valid position < item_count_
+            throws  PrecondViolatedExcep */
+   const T& getEntry(int position) const;
+
+   /**@return the first block of the chain, nullptr if the list is empty */
+   const Block* getHeadBlock() const;
+
+   /**@return iterator to the first entry, equal to end() if the list is empty */
+   iterator begin();
+   const_iterator begin() const;
+   const_iterator cbegin() const;
+
+   /**@return iterator one past the last entry */
+   iterator end();
+   const_iterator end() const;
+   const_iterator cend() const;
+
+    /**
+     @param entry to be searched for
+     @return iterator to the first entry equal to entry, end() if there is none. Linear time */
+   iterator find(const T& entry);
+   const_iterator find(const T& entry) const;
+
+    /**
+     @pre position refers to an entry of this list (it is not end())
+     @param position iterator to the entry to be deleted
+     @post the entry is deleted in O(CAPACITY) time. Iterators into the
+           entry's block and the block after it are invalidated
+     @return iterator to the entry that followed the deleted one */
+   iterator erase(iterator position);
+
+    /**
+     @pre position refers to an entry of this list (it is not end())
+     @param position iterator to the entry to be moved
+     @post the entry is moved to the head of the list in O(CAPACITY) time.
+           Other iterators are invalidated
+     @return iterator to the moved entry, now equal to begin() */
+   iterator moveToFront(iterator position);
+
+    /**
+     @pre position and source refer to entries of this list, position not after source
+     @param position iterator to the entry after which to move
+     @param source iterator to the entry to be moved
+     @post the entry of source is moved right after position; the entries in
+           between shift back by one. Other iterators are invalidated
+     @return iterator to the moved entry */
+   iterator spliceAfter(iterator position, iterator source);
+
+private:
+   Block* head_ptr_; // First block in the chain
+   Block* tail_ptr_; // Last block in the chain (nullptr if empty)
+   int item_count_;  // Current count of list items
+
+   // Locates the block that holds a position.
+   // @pre 0 <= position <= item_count_
+   // @param position the index of the desired entry
+   // @param index set to the index of the entry within the returned block
+   // @param prev_block set to the block before the returned one
+   // @return the block holding the position; for position == item_count_ the tail block
+   Block* locate(int position, std::size_t& index, Block*& prev_block) const;
+
+   // Makes room for one entry at index of block, splitting the block when it is full.
+   // @param block the block receiving the entry
+   // @param index position within block, 0 <= index <= block->count_
+   // @return the slot where the new entry must be constructed
+   T* openSlot(Block* block, std::size_t index);
+
+   // Removes the entry at index of block and unlinks or merges the block as needed.
+   // @return iterator to the entry that followed the removed one
+   iterator removeAt(Block* prev_block, Block* block, std::size_t index);
+}; // end UnrolledList
+
+#include "UnrolledList.cpp"
+#endif
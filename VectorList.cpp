@@ -0,0 +1,260 @@
+/** ADT list: contiguous (vector) implementation.
+
+ Implementation file for the class VectorList.
+ @file VectorList.cpp */
+
+#include "VectorList.hpp"  // Header file
+#include <algorithm>
+#include <string>
+#include <utility>
+
+// constructor
+template<class T>
+VectorList<T>::VectorList()
+{
+}  // end default constructor
+
+
+/**@return true if list is empty - getLength() == 0 */
+template<class T>
+bool VectorList<T>::isEmpty() const
+{
+   return items_.empty();
+}  // end isEmpty
+
+
+/**@return the number of items in the list */
+template<class T>
+int VectorList<T>::getLength() const
+{
+   return static_cast<int>(items_.size());
+}  // end getLength
+
+
+/**
+ @pre list positions follow traditional indexing from 0 to getLength() -1
+ @param position indicating point of insertion
+ @param new_entry to be inserted in list
+ @post new_entry is added at position in list (the entry previously at that position is now at position+1)
+ @return true if valid position (0 <= position <= getLength()) */
+template<class T>
+bool VectorList<T>::insert(int position, const T& new_entry)
+{
+   return emplace(position, new_entry);
+}  // end insert
+
+
+template<class T>
+bool VectorList<T>::insert(int position, T&& new_entry)
+{
+   return emplace(position, std::move(new_entry));
+}  // end insert
+
+
+/**
+ @pre list positions follow traditional indexing from 0 to getLength() -1
+ @param position indicating point of insertion
+ @param args forwarded to the constructor of T
+ @post an entry constructed in place from args is added at position in list
+ @return true if valid position (0 <= position <= getLength()) */
+template<class T>
+template<class... Args>
+bool VectorList<T>::emplace(int position, Args&&... args)
+{
+   bool ableToInsert = (position >= 0) && (position <= getLength());
+   if (ableToInsert)
+      items_.emplace(items_.begin() + position, std::forward<Args>(args)...);
+   return ableToInsert;
+}  // end emplace
+
+
+/**
+ @param new_entry to be inserted in list
+ @post new_entry is added at the end of the list, in amortized constant time */
+template<class T>
+void VectorList<T>::pushBack(const T& new_entry)
+{
+   items_.push_back(new_entry);
+}  // end pushBack
+
+
+template<class T>
+void VectorList<T>::pushBack(T&& new_entry)
+{
+   items_.push_back(std::move(new_entry));
+}  // end pushBack
+
+
+/**
+ @param new_entry to be inserted in list
+ @post new_entry is added at the beginning of the list, shifting every entry */
+template<class T>
+void VectorList<T>::pushFront(const T& new_entry)
+{
+   items_.insert(items_.begin(), new_entry);
+}  // end pushFront
+
+
+template<class T>
+void VectorList<T>::pushFront(T&& new_entry)
+{
+   items_.insert(items_.begin(), std::move(new_entry));
+}  // end pushFront
+
+
+/**
+ @pre list positions follow traditional indexing from 0 to getLength() -1
+ @param position indicating point of deletion
+ @post entry at position is deleted, if any. List order is retained
+ @return true if there is an entry at position to be deleted, false otherwise */
+template<class T>
+bool VectorList<T>::remove(int position)
+{
+   bool ableToRemove = (position >= 0) && (position < getLength());
+   if (ableToRemove)
+      items_.erase(items_.begin() + position);
+   return ableToRemove;
+}  // end remove
+
+
+/**@post the list is empty and getLength() == 0*/
+template<class T>
+void VectorList<T>::clear()
+{
+   items_.clear();
+}  // end clear
+
+
+/**
+ @pre list positions follow traditional indexing from 0 to getLength() -1
+ @param position indicating the position of the data to be retrieved
+ @return reference to the data item found at position, in constant time.
+        If position is not a valid position < getLength() throws  PrecondViolatedExcep */
+template<class T>
+const T& VectorList<T>::getEntry(int position) const
+{
+   // Enforce precondition
+   bool ableToGet = (position >= 0) && (position < getLength());
+   if (ableToGet)
+   {
+      return items_[position];
+   }
+   else
+   {
+      std::string message = "getEntry() called with an empty list or ";
+      message  = message + "invalid position.";
+      throw(PrecondViolatedExcep(message));
+   }  // end if
+}  // end getEntry
+
+
+/**@return iterator to the first entry, equal to end() if the list is empty */
+template<class T>
+typename VectorList<T>::iterator VectorList<T>::begin()
+{
+   return items_.begin();
+}  // end begin
+
+
+template<class T>
+typename VectorList<T>::const_iterator VectorList<T>::begin() const
+{
+   return items_.begin();
+}  // end begin
+
+
+template<class T>
+typename VectorList<T>::const_iterator VectorList<T>::cbegin() const
+{
+   return items_.cbegin();
+}  // end cbegin
+
+
+/**@return iterator one past the last entry */
+template<class T>
+typename VectorList<T>::iterator VectorList<T>::end()
+{
+   return items_.end();
+}  // end end
+
+
+template<class T>
+typename VectorList<T>::const_iterator VectorList<T>::end() const
+{
+   return items_.end();
+}  // end end
+
+
+template<class T>
+typename VectorList<T>::const_iterator VectorList<T>::cend() const
+{
+   return items_.cend();
+}  // end cend
+
+
+/**
+ @param entry to be searched for
+ @return iterator to the first entry equal to entry, end() if there is none. Linear time */
+template<class T>
+typename VectorList<T>::iterator VectorList<T>::find(const T& entry)
+{
+   return std::find(begin(), end(), entry);
+}  // end find
+
+
+template<class T>
+typename VectorList<T>::const_iterator VectorList<T>::find(const T& entry) const
+{
+   return std::find(begin(), end(), entry);
+}  // end find
+
+
+/**
+ @pre position refers to an entry of this list (it is not end())
+ @param position iterator to the entry to be deleted
+ @post the entry is deleted and the later ones shift back. Iterators to the
+       deleted entry and later ones are invalidated
+ @return iterator to the entry that followed the deleted one */
+template<class T>
+typename VectorList<T>::iterator VectorList<T>::erase(iterator position)
+{
+   return items_.erase(position);
+}  // end erase
+
+
+/**
+ @pre position refers to an entry of this list (it is not end())
+ @param position iterator to the entry to be moved
+ @post the entry is moved to the head of the list; the entries before it
+       shift back by one. Other iterators are invalidated
+ @return iterator to the moved entry, now equal to begin() */
+template<class T>
+typename VectorList<T>::iterator VectorList<T>::moveToFront(iterator position)
+{
+   std::rotate(items_.begin(), position, position + 1);
+   return items_.begin();
+}  // end moveToFront
+
+
+/**
+ @pre position and source refer to entries of this list (neither is end())
+ @param position iterator to the entry after which to move
+ @param source iterator to the entry to be moved
+ @post the entry of source is moved right after position; the entries in
+       between shift by one. Other iterators are invalidated
+ @return iterator to the moved entry */
+template<class T>
+typename VectorList<T>::iterator VectorList<T>::spliceAfter(iterator position, iterator source)
+{
+   if (position < source)
+   {
+      std::rotate(position + 1, source, source + 1);  // Entries in between shift back
+      return position + 1;
+   }
+   if (source < position)
+   {
+      std::rotate(source, source + 1, position + 1);  // Entries in between shift forward
+      return position;
+   }
+   return source;
+}  // end spliceAfter
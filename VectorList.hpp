@@ -0,0 +1,123 @@
+/** ADT list: contiguous (vector) implementation.
+    The entries live in one std::vector, so traversals stream through memory and
+    getEntry is constant time; inserts, removals and moves shift the entries
+    after them. The interface mirrors LinkedList, so the two can be swapped at
+    compile time.
+    @file VectorList.hpp */
+
+#ifndef VECTOR_LIST_
+#define VECTOR_LIST_
+
+#include <cstddef>
+#include <vector>
+#include "PrecondViolatedExcep.hpp"
+
+template<class T>
+class VectorList
+{
+public:
+   using iterator = typename std::vector<T>::iterator;
+   using const_iterator = typename std::vector<T>::const_iterator;
+
+   VectorList(); // constructor
+
+   /**@return true if list is empty - getLength() == 0 */
+   bool isEmpty() const;
+
+   /**@return the number of items in the list */
+   int getLength() const;
+
+    /**
+     @pre list positions follow traditional indexing from 0 to getLength() -1
+     @param position indicating point of insertion
+     @param new_entry to be inserted in list
+     @post new_entry is added at position in list (the entry previously at that position is now at position+1)
+     @return true if valid position (0 <= position <= getLength()) */
+   bool insert(int position, const T& new_entry);
+   bool insert(int position, T&& new_entry);
+
+    /**
+     @pre list positions follow traditional indexing from 0 to getLength() -1
+     @param position indicating point of insertion
+     @param args forwarded to the constructor of T
+     @post an entry constructed in place from args is added at position in list
+     @return true if valid position (0 <= position <= getLength()) */
+   template<class... Args>
+   bool emplace(int position, Args&&... args);
+
+    /**
+     @param new_entry to be inserted in list
+     @post new_entry is added at the end of the list, in amortized constant time */
+   void pushBack(const T& new_entry);
+   void pushBack(T&& new_entry);
+
+    /**
+     @param new_entry to be inserted in list
+     @post new_entry is added at the beginning of the list, shifting every entry */
+   void pushFront(const T& new_entry);
+   void pushFront(T&& new_entry);
+
+    /**
+     @pre list positions follow traditional indexing from 0 to getLength() -1
+     @param position indicating point of deletion
+     @post entry at position is deleted, if any. List order is retained
+     @return true if there is an entry at position to be deleted, false otherwise */
+   bool remove(int position);
+
+   /**@post the list is empty and getLength() == 0*/
+   void clear();
+
+    /**
+     @pre list positions follow traditional indexing from 0 to getLength() -1
+     @param position indicating the position of the data to be retrieved
+     @return reference to the data item found at position, in constant time.
+            If position is not a valid position < getLength() throws  PrecondViolatedExcep */
+   const T& getEntry(int position) const;
+
+   /**@return iterator to the first entry, equal to end() if the list is empty */
+   iterator begin();
+   const_iterator begin() const;
+   const_iterator cbegin() const;
+
+   /**@return iterator one past the last entry */
+   iterator end();
+   const_iterator end() const;
+   const_iterator cend() const;
+
+    /**
+     @param entry to be searched for
+     @return iterator to the first entry equal to entry, end() if there is none. Linear time */
+   iterator find(const T& entry);
+   const_iterator find(const T& entry) const;
+
+    /**
+     @pre position refers to an entry of this list (it is not end())
+     @param position iterator to the entry to be deleted
+     @post the entry is deleted and the later ones shift back. Iterators to the
+           deleted entry and later ones are invalidated
+     @return iterator to the entry that followed the deleted one */
+   iterator erase(iterator position);
+
+    /**
+     @pre position refers to an entry of this list (it is not end())
+     @param position iterator to the entry to be moved
+     @post the entry is moved to the head of the list; the entries before it
+           shift back by one. Other iterators are invalidated
+     @return iterator to the moved entry, now equal to begin() */
+   iterator moveToFront(iterator position);
+
+    /**
+     @pre position and source refer to entries of this list (neither is end())
+     @param position iterator to the entry after which to move
+     @param source iterator to the entry to be moved
+     @post the entry of source is moved right after position; the entries in
+           between shift by one. Other iterators are invalidated
+     @return iterator to the moved entry */
+   iterator spliceAfter(iterator position, iterator source);
+
+private:
+   std::vector<T> items_; // The entries, in list order
+}; // end VectorList
+
+#include "VectorList.cpp"
+#endif
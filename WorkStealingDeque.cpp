@@ -0,0 +1,97 @@
+/** ADT deque: bounded work-stealing implementation.
+
+ Implementation file for the class WorkStealingDeque. The owner's update of the bottom and the thieves' reads of it
+ are sequentially consistent, as are the compare-and-swaps on the top, which stand in for the fences of the original
+ algorithm: an owner popping and a thief stealing each see the other's claim, so the last entry goes to one of them.
+ @file WorkStealingDeque.cpp */
+
+#include "WorkStealingDeque.hpp"  // Header file
+
+// constructor
+template<class T>
+WorkStealingDeque<T>::WorkStealingDeque(std::size_t capacity) : top_(0), bottom_(0)
+{
+   std::size_t entry_count = 2;
+   while (entry_count < capacity)
+   {
+      entry_count *= 2;
+   }
+   entries_.reset(new std::atomic<T>[entry_count]);
+   mask_ = static_cast<long long>(entry_count) - 1;
+}  // end constructor
+
+
+/** To be called by the owner only.
+ @param new_entry to be added at the bottom
+ @return true if the entry was added, false if the deque was full */
+template<class T>
+bool WorkStealingDeque<T>::pushBottom(const T& new_entry)
+{
+   const long long bottom = bottom_.load(std::memory_order_relaxed);
+   const long long top = top_.load(std::memory_order_acquire);
+   if (bottom - top > mask_)
+   {
+      return false;
+   }
+   entries_[bottom & mask_].store(new_entry, std::memory_order_relaxed);
+   bottom_.store(bottom + 1, std::memory_order_release);  // Publishes the entry to the thieves
+   return true;
+}  // end pushBottom
+
+
+/** To be called by the owner only.
+ @param entry set to the entry at the bottom, the one pushed last, if any
+ @post the entry is removed from the deque
+ @return true if an entry was removed, false if the deque was empty or a thief took the last one */
+template<class T>
+bool WorkStealingDeque<T>::popBottom(T& entry)
+{
+   const long long bottom = bottom_.load(std::memory_order_relaxed) - 1;
+   bottom_.store(bottom, std::memory_order_seq_cst);  // Claims the bottom entry before looking at the top
+   long long top = top_.load(std::memory_order_seq_cst);
+   if (top > bottom)
+   {
+      bottom_.store(bottom + 1, std::memory_order_relaxed);  // Was empty
+      return false;
+   }
+   entry = entries_[bottom & mask_].load(std::memory_order_relaxed);
+   if (top < bottom)
+   {
+      return true;  // More than one entry: no thief can reach this one
+   }
+   // The last entry: whoever moves the top past it first takes it
+   const bool won = top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+   bottom_.store(bottom + 1, std::memory_order_relaxed);
+   return won;
+}  // end popBottom
+
+
+/** May be called from any thread.
+ @param entry set to the entry at the top, the one pushed first, if any
+ @post the entry is removed from the deque
+ @return true if an entry was removed, false if the deque was empty or another thread took it first */
+template<class T>
+bool WorkStealingDeque<T>::steal(T& entry)
+{
+   long long top = top_.load(std::memory_order_seq_cst);
+   const long long bottom = bottom_.load(std::memory_order_seq_cst);
+   if (top >= bottom)
+   {
+      return false;
+   }
+   T stolen = entries_[top & mask_].load(std::memory_order_relaxed);
+   if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+   {
+      return false;  // The owner or another thief got there first
+   }
+   entry = stolen;
+   return true;
+}  // end steal
+
+
+/**@return true if the deque looked empty */
+template<class T>
+bool WorkStealingDeque<T>::isEmpty() const
+{
+   return top_.load(std::memory_order_acquire) >= bottom_.load(std::memory_order_acquire);
+}  // end isEmpty
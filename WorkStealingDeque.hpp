@@ -0,0 +1,57 @@
+/** ADT deque: bounded work-stealing implementation.
+    The deque of Chase and Lev on a ring of fixed size. Its owner pushes and
+    pops at the bottom without contention; any other thread may steal from the
+    top, so that the entries pushed first are the first stolen. Owner and
+    thieves race for the last entry with a single compare-and-swap on the top.
+    @file WorkStealingDeque.hpp */
+
+#ifndef WORK_STEALING_DEQUE_
+#define WORK_STEALING_DEQUE_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+/** @param T type of the entries, which must be trivially copyable (e.g. a pointer) */
+template<class T>
+class WorkStealingDeque
+{
+public:
+   /** @param capacity the number of entries the deque holds at most, rounded up to a power of two (at least 2)
+       @post the deque is empty */
+   explicit WorkStealingDeque(std::size_t capacity);
+   WorkStealingDeque(const WorkStealingDeque& other) = delete;
+   WorkStealingDeque& operator=(const WorkStealingDeque& other) = delete;
+
+   /** To be called by the owner only.
+       @param new_entry to be added at the bottom
+       @return true if the entry was added, false if the deque was full */
+   bool pushBottom(const T& new_entry);
+
+   /** To be called by the owner only.
+       @param entry set to the entry at the bottom, the one pushed last, if any
+       @post the entry is removed from the deque
+       @return true if an entry was removed, false if the deque was empty or a thief took the last one */
+   bool popBottom(T& entry);
+
+   /** May be called from any thread.
+       @param entry set to the entry at the top, the one pushed first, if any
+       @post the entry is removed from the deque
+       @return true if an entry was removed, false if the deque was empty or another thread took it first */
+   bool steal(T& entry);
+
+   /**@return true if the deque looked empty */
+   bool isEmpty() const;
+
+private:
+   static constexpr std::size_t CACHE_LINE = 64;
+
+   std::unique_ptr<std::atomic<T>[]> entries_;
+   long long mask_; // capacity - 1
+   // Positions only grow; top <= bottom except while the owner pops the last entry
+   alignas(CACHE_LINE) std::atomic<long long> top_;    // next entry to steal
+   alignas(CACHE_LINE) std::atomic<long long> bottom_; // next slot the owner pushes to
+}; // end WorkStealingDeque
+
+#include "WorkStealingDeque.cpp"
+#endif
@@ -0,0 +1,73 @@
+/**
+ * @file Benchmark.hpp
+ * @brief This file contains the timing helpers shared by the bistro benchmarks and the declarations of every benchmark.
+ *
+ * Each benchmark lives in its own translation unit under benchmarks/ and is registered by name in bench_main.cpp.
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <chrono>
+#include <string>
+
+/**
+ * Runs a callable once and measures it.
+ * @param work The callable to time.
+ * @return The elapsed wall-clock time in milliseconds.
+ */
+template<class Work>
+double timeMs(Work&& work) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+/**
+ * Builds a station name that is unique for the given index.
+ * @param index The number of the station.
+ * @return A name of the form "Station <index>".
+ */
+inline std::string stationName(int index) {
+    return "Station " + std::to_string(index);
+}
+
+/**
+ * Builds a dish name that is unique for the given index. Dish names may only hold letters and spaces,
+ * so the index is spelled in base 26.
+ * @param index The number of the dish.
+ * @return A name of the form "Dish <letters>".
+ */
+inline std::string dishName(int index) {
+    std::string letters;
+    do {
+        letters.insert(letters.begin(), static_cast<char>('a' + index % 26));
+        index /= 26;
+    } while (index > 0);
+    return "Dish " + letters;
+}
+
+// Benchmarks, one per translation unit
+void benchAppend();
+void benchPool();
+void benchPolicy();
+void benchMove();
+void benchUnrolled();
+void benchSkipList();
+void benchBackends();
+void benchStock();
+void benchBatch();
+void benchMenu();
+void benchDishIndex();
+void benchSymbols();
+void benchConcurrency();
+void benchReservations();
+void benchPipeline();
+void benchStealing();
+void benchSearch();
+
+#endif // BENCHMARK_HPP
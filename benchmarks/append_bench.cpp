@@ -0,0 +1,59 @@
+/**
+ * @file append_bench.cpp
+ * @brief This file contains the bulk station registration benchmark.
+ *
+ * It compares StationManager::addStation, which appends through the tail pointer, against a positional insert
+ * that still has to walk the chain to find its predecessor. The per-station cost of addStation should stay flat
+ * as the floor grows, while the positional insert grows linearly with the floor size.
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "Benchmark.hpp"
+#include "StationManager.hpp"
+
+void benchAppend() {
+    std::cout << std::setw(10) << "stations"
+              << std::setw(22) << "addStation (ms)"
+              << std::setw(22) << "ns / station"
+              << std::setw(26) << "insert(len - 1) (ms)"
+              << std::setw(22) << "ns / station" << "\n";
+
+    for (int count : {1000, 5000, 10000, 20000}) {
+        std::vector<KitchenStation*> stations;
+        stations.reserve(count);
+        for (int i = 0; i < count; i++) {
+            stations.push_back(new KitchenStation(stationName(i)));
+        }
+
+        StationManager manager;
+        double append_ms = timeMs([&] {
+            for (KitchenStation* station : stations) {
+                manager.addStation(station);
+            }
+        });
+
+        LinkedList<KitchenStation*> walked;
+        double walk_ms = timeMs([&] {
+            walked.insert(0, stations[0]);
+            for (int i = 1; i < count; i++) {
+                walked.insert(walked.getLength() - 1, stations[i]);
+            }
+        });
+
+        std::cout << std::setw(10) << count
+                  << std::setw(22) << std::fixed << std::setprecision(3) << append_ms
+                  << std::setw(22) << std::setprecision(1) << append_ms * 1e6 / count
+                  << std::setw(26) << std::setprecision(3) << walk_ms
+                  << std::setw(22) << std::setprecision(1) << walk_ms * 1e6 / count << "\n";
+
+        manager.clear();
+        for (KitchenStation* station : stations) {
+            delete station;
+        }
+    }
+}
@@ -0,0 +1,103 @@
+/**
+ * @file backend_bench.cpp
+ * @brief This file contains the storage backend benchmark.
+ *
+ * One synthetic workload is replayed against a BasicStationManager built on each station list: skewed lookups
+ * under the move-to-front policy, explicit moves to the front, stations leaving and rejoining the floor, positional
+ * reads, and full scans for an order no station can complete.
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "Benchmark.hpp"
+#include "StationManager.hpp"
+
+namespace {
+
+const int kStations = 2000;
+const int kOperations = 20000;
+volatile bool g_sink;  // Keeps the scans from being optimized away
+
+enum Operation { LOOKUP, MOVE_TO_FRONT, REJOIN, READ, SCAN };
+
+struct Step {
+    Operation operation;
+    int station;
+};
+
+template<class List>
+void measure(const char* label, const std::vector<Step>& workload) {
+    BasicStationManager<List> manager;
+    manager.setAccessPolicy(StationAccessPolicy::MOVE_TO_FRONT);
+    for (int i = 0; i < kStations; i++) {
+        manager.addStation(new KitchenStation(stationName(i)));
+    }
+
+    bool sink = false;
+    double elapsed = timeMs([&] {
+        for (const Step& step : workload) {
+            const std::string name = stationName(step.station);
+            switch (step.operation) {
+                case LOOKUP:
+                    manager.findStation(name);
+                    break;
+                case MOVE_TO_FRONT:
+                    manager.moveStationToFront(name);
+                    break;
+                case REJOIN:
+                    manager.removeStation(name);
+                    manager.addStation(new KitchenStation(name));
+                    break;
+                case READ:
+                    sink ^= manager.getEntry(step.station) == nullptr;
+                    break;
+                case SCAN:
+                    sink ^= manager.canCompleteOrder("Unknown Dish");
+                    break;
+            }
+        }
+    });
+    g_sink = sink;
+
+    for (KitchenStation* station : manager) {
+        delete station;
+    }
+    manager.clear();
+
+    std::cout << std::setw(12) << label << std::setw(14) << std::fixed << std::setprecision(2) << elapsed << "\n";
+}
+
+} // namespace
+
+void benchBackends() {
+    // Lookups and moves favour a few popular stations; the rest of the mix is uniform
+    std::vector<double> weights(kStations);
+    for (int rank = 0; rank < kStations; rank++) {
+        weights[rank] = 1.0 / (rank + 1);
+    }
+    std::mt19937 rng(235);
+    std::discrete_distribution<int> popular(weights.begin(), weights.end());
+    std::uniform_int_distribution<int> any(0, kStations - 1);
+    std::discrete_distribution<int> mix({50, 15, 15, 15, 5});
+
+    std::vector<Step> workload;
+    workload.reserve(kOperations);
+    for (int i = 0; i < kOperations; i++) {
+        Operation operation = static_cast<Operation>(mix(rng));
+        bool skewed = operation == LOOKUP || operation == MOVE_TO_FRONT;
+        workload.push_back({operation, skewed ? popular(rng) : any(rng)});
+    }
+
+    std::cout << std::setw(12) << "backend" << std::setw(14) << "ms" << "\n";
+    measure<StationList>("linked", workload);
+    measure<UnrolledStationList>("unrolled", workload);
+    measure<SkipStationList>("skip", workload);
+    measure<VectorStationList>("vector", workload);
+    measure<HashedStationList>("hashed", workload);
+}
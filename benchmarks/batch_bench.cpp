@@ -0,0 +1,97 @@
+/**
+ * @file batch_bench.cpp
+ * @brief This file contains the batch preparation benchmark.
+ *
+ * The same rush of tickets, each a number of servings of one dish at one station, is served twice: once as one
+ * prepareDishAtStation call per serving and once as a single batch call per ticket.
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "Benchmark.hpp"
+#include "StationManager.hpp"
+
+namespace {
+
+const int kStations = 200;
+const int kDishesPerStation = 20;
+const int kIngredientsPerDish = 8;
+const int kTickets = 5000;
+
+struct Ticket {
+    std::string station;
+    std::string dish;
+    int servings;
+};
+
+// Every station gets the same menu and enough stock that no ticket is refused.
+void buildFloor(StationManager& manager) {
+    for (int i = 0; i < kStations; i++) {
+        manager.addStation(new KitchenStation(stationName(i)));
+        for (int s = 0; s < kIngredientsPerDish * 4; s++) {
+            manager.replenishIngredientAtStation(stationName(i), Ingredient("SKU " + std::to_string(s), 100000000, 0, 1.0));
+        }
+        for (int d = 0; d < kDishesPerStation; d++) {
+            std::vector<Ingredient> ingredients;
+            for (int k = 0; k < kIngredientsPerDish; k++) {
+                ingredients.emplace_back("SKU " + std::to_string((d + k * 3) % (kIngredientsPerDish * 4)), 0, 1, 1.0);
+            }
+            manager.assignDishToStation(stationName(i), new Dish(dishName(d), ingredients));
+        }
+    }
+}
+
+void tearDown(StationManager& manager) {
+    for (KitchenStation* station : manager) {
+        delete station;
+    }
+    manager.clear();
+}
+
+} // namespace
+
+void benchBatch() {
+    std::mt19937 rng(235);
+    std::uniform_int_distribution<int> any_station(0, kStations - 1);
+    std::uniform_int_distribution<int> any_dish(0, kDishesPerStation - 1);
+    std::uniform_int_distribution<int> any_size(1, 30);
+    std::vector<Ticket> tickets;
+    long long servings = 0;
+    for (int i = 0; i < kTickets; i++) {
+        tickets.push_back({stationName(any_station(rng)), dishName(any_dish(rng)), any_size(rng)});
+        servings += tickets.back().servings;
+    }
+
+    StationManager one_by_one;
+    buildFloor(one_by_one);
+    double single_ms = timeMs([&] {
+        for (const Ticket& ticket : tickets) {
+            for (int s = 0; s < ticket.servings; s++) {
+                one_by_one.prepareDishAtStation(ticket.station, ticket.dish);
+            }
+        }
+    });
+    tearDown(one_by_one);
+
+    StationManager batched;
+    buildFloor(batched);
+    double batch_ms = timeMs([&] {
+        for (const Ticket& ticket : tickets) {
+            batched.prepareDishAtStation(ticket.station, ticket.dish, ticket.servings);
+        }
+    });
+    tearDown(batched);
+
+    std::cout << kTickets << " tickets, " << servings << " servings\n";
+    std::cout << std::setw(16) << "serving" << std::setw(14) << "ms" << std::setw(22) << "ns / serving" << "\n";
+    std::cout << std::setw(16) << "one by one" << std::setw(14) << std::fixed << std::setprecision(2) << single_ms
+              << std::setw(22) << std::setprecision(1) << single_ms * 1e6 / servings << "\n";
+    std::cout << std::setw(16) << "batched" << std::setw(14) << std::setprecision(2) << batch_ms
+              << std::setw(22) << std::setprecision(1) << batch_ms * 1e6 / servings << "\n";
+}
@@ -0,0 +1,69 @@
+/**
+ * @file bench_main.cpp
+ * @brief This file contains the entry point of the benchmark driver.
+ *
+ * Run with no arguments to execute every benchmark, or pass one or more benchmark names to run only those.
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#include <iostream>
+#include <string>
+#include "Benchmark.hpp"
+
+namespace {
+
+struct BenchmarkEntry {
+    const char* name;
+    void (*run)();
+};
+
+const BenchmarkEntry kBenchmarks[] = {
+    {"append", benchAppend},
+    {"pool", benchPool},
+    {"policy", benchPolicy},
+    {"move", benchMove},
+    {"unrolled", benchUnrolled},
+    {"skiplist", benchSkipList},
+    {"backends", benchBackends},
+    {"stock", benchStock},
+    {"batch", benchBatch},
+    {"menu", benchMenu},
+    {"dishindex", benchDishIndex},
+    {"symbols", benchSymbols},
+    {"concurrency", benchConcurrency},
+    {"reservations", benchReservations},
+    {"pipeline", benchPipeline},
+    {"stealing", benchStealing},
+    {"search", benchSearch},
+};
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    bool ran_any = false;
+    for (const auto& entry : kBenchmarks) {
+        bool selected = (argc == 1);
+        for (int i = 1; i < argc; i++) {
+            if (entry.name == std::string(argv[i])) {
+                selected = true;
+            }
+        }
+        if (selected) {
+            std::cout << "== " << entry.name << " ==\n";
+            entry.run();
+            std::cout << "\n";
+            ran_any = true;
+        }
+    }
+    if (!ran_any) {
+        std::cerr << "Unknown benchmark. Available:";
+        for (const auto& entry : kBenchmarks) {
+            std::cerr << " " << entry.name;
+        }
+        std::cerr << "\n";
+        return 1;
+    }
+    return 0;
+}
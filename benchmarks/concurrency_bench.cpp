@@ -0,0 +1,197 @@
+/**
+ * @file concurrency_bench.cpp
+ * @brief This file contains the concurrent orders benchmark.
+ *
+ * Several threads fire a mix of orders at one StationManager in LOCKED mode: availability checks, preparations at a
+ * station and replenishments. The same total number of orders is split among 1 to 16 threads, and the throughput is
+ * reported against the single-threaded manager. After each run, the stock of every station is checked against the
+ * initial stock, the replenishments and the preparations the threads saw succeed: a preparation whose check and
+ * deduction were not atomic would oversell and break the balance.
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "Benchmark.hpp"
+#include "StationManager.hpp"
+
+namespace {
+
+const int kStations = 32;
+const int kDishes = 64;
+const int kDishesPerStation = 8;
+const int kSkus = 12;
+const int kStock = 1000; // Initial quantity of every SKU at every station
+const int kRestock = 40;
+const int kOrders = 400000; // Split among the threads
+volatile std::size_t g_sink;  // Keeps the answers from being optimized away
+
+std::string skuName(int index) {
+    return "SKU " + std::to_string(index);
+}
+
+/**
+ * The floor the threads share, and what they are allowed to order from it.
+ */
+struct Floor {
+    StationManager manager;
+    std::vector<std::string> station_names;
+    std::vector<Symbol> dish_symbols;
+    std::vector<std::string> dish_names;
+    std::vector<std::vector<std::pair<int, int>>> recipes; // Dish -> (SKU, required quantity)
+    std::vector<std::vector<int>> menus; // Station -> dishes it carries
+};
+
+/**
+ * What one thread saw happen, by station and SKU.
+ */
+struct Tally {
+    std::vector<long long> consumed;
+    std::vector<long long> restocked;
+    std::size_t available = 0;
+
+    Tally() : consumed(kStations * kSkus, 0), restocked(kStations * kSkus, 0) {}
+};
+
+void buildFloor(Floor& floor, KitchenStation::ConcurrencyMode mode) {
+    std::mt19937 rng(235);
+    std::uniform_int_distribution<int> any_sku(0, kSkus - 1);
+    std::uniform_int_distribution<int> any_dish(0, kDishes - 1);
+    for (int d = 0; d < kDishes; d++) {
+        floor.dish_names.push_back(dishName(d));
+        floor.dish_symbols.push_back(Symbol(dishName(d)));
+        floor.recipes.emplace_back();
+        int first = any_sku(rng);
+        for (int k = 0; k < 3; k++) {
+            floor.recipes.back().emplace_back((first + k * 5) % kSkus, 1 + k % 2);  // Distinct SKUs
+        }
+    }
+    for (int i = 0; i < kStations; i++) {
+        floor.station_names.push_back(stationName(i));
+        floor.manager.addStation(new KitchenStation(stationName(i)));
+        for (int s = 0; s < kSkus; s++) {
+            floor.manager.replenishIngredientAtStation(stationName(i), Ingredient(skuName(s), kStock, 0, 1.0));
+        }
+        floor.menus.emplace_back();
+        for (int k = 0; k < kDishesPerStation; k++) {
+            int d = any_dish(rng);
+            std::vector<Ingredient> ingredients;
+            for (const auto& step : floor.recipes[d]) {
+                ingredients.emplace_back(skuName(step.first), 0, step.second, 1.0);
+            }
+            Dish* dish = new Dish(dishName(d), ingredients);
+            if (floor.manager.assignDishToStation(stationName(i), dish)) {
+                floor.menus.back().push_back(d);
+            } else {
+                delete dish;
+            }
+        }
+    }
+    floor.manager.setConcurrencyMode(mode);
+}
+
+void fireOrders(Floor& floor, int orders, unsigned seed, Tally& tally) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> any_station(0, kStations - 1);
+    std::uniform_int_distribution<int> any_dish(0, kDishes - 1);
+    std::uniform_int_distribution<int> any_sku(0, kSkus - 1);
+    std::uniform_int_distribution<int> any_kind(0, 99);
+    for (int i = 0; i < orders; i++) {
+        int kind = any_kind(rng);
+        if (kind < 70) {
+            tally.available += floor.manager.canCompleteOrder(floor.dish_symbols[any_dish(rng)]);
+        } else if (kind < 95) {
+            int station = any_station(rng);
+            const std::vector<int>& menu = floor.menus[station];
+            int dish = menu[rng() % menu.size()];
+            if (floor.manager.prepareDishAtStation(floor.station_names[station], floor.dish_names[dish])) {
+                for (const auto& step : floor.recipes[dish]) {
+                    tally.consumed[station * kSkus + step.first] += step.second;
+                }
+            }
+        } else {
+            int station = any_station(rng);
+            int sku = any_sku(rng);
+            floor.manager.replenishIngredientAtStation(floor.station_names[station],
+                                                       Ingredient(skuName(sku), kRestock, 0, 1.0));
+            tally.restocked[station * kSkus + sku] += kRestock;
+        }
+    }
+}
+
+/**
+ * @return: True if every station's stock matches what the threads saw happen.
+ */
+bool stockBalances(const Floor& floor, const std::vector<Tally>& tallies) {
+    for (int i = 0; i < kStations; i++) {
+        std::vector<long long> expected(kSkus, kStock);
+        for (const Tally& tally : tallies) {
+            for (int s = 0; s < kSkus; s++) {
+                expected[s] += tally.restocked[i * kSkus + s] - tally.consumed[i * kSkus + s];
+            }
+        }
+        std::vector<long long> actual(kSkus, 0);
+        for (const Ingredient& ingredient : floor.manager.findStation(floor.station_names[i])->getIngredientsStock()) {
+            actual[std::stoi(ingredient.name.str().substr(4))] = ingredient.quantity;
+        }
+        if (actual != expected) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Runs the order mix on a fresh floor.
+ * @return: Orders per second.
+ */
+double runFloor(KitchenStation::ConcurrencyMode mode, int threads, bool& balanced) {
+    Floor floor;
+    buildFloor(floor, mode);
+    std::vector<Tally> tallies(threads);
+    double ms = timeMs([&] {
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; t++) {
+            workers.emplace_back(fireOrders, std::ref(floor), kOrders / threads, 100u + t, std::ref(tallies[t]));
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    });
+    balanced = stockBalances(floor, tallies);
+    for (const Tally& tally : tallies) {
+        g_sink = g_sink + tally.available;
+    }
+    for (KitchenStation* station : floor.manager) {
+        delete station;
+    }
+    floor.manager.clear();
+    return (kOrders / threads) * threads / (ms / 1e3);
+}
+
+} // namespace
+
+void benchConcurrency() {
+    std::cout << kStations << " stations, " << kOrders << " orders (70% checks, 25% preparations, 5% restocks), "
+              << std::thread::hardware_concurrency() << " hardware threads\n";
+    std::cout << std::setw(16) << "mode" << std::setw(10) << "threads" << std::setw(18) << "k orders / s"
+              << std::setw(12) << "stock" << "\n";
+    const std::pair<KitchenStation::ConcurrencyMode, int> runs[] = {
+        {KitchenStation::SINGLE_THREADED, 1}, {KitchenStation::LOCKED, 1}, {KitchenStation::LOCKED, 2},
+        {KitchenStation::LOCKED, 4}, {KitchenStation::LOCKED, 8}, {KitchenStation::LOCKED, 16},
+    };
+    for (const auto& run : runs) {
+        bool balanced = false;
+        double rate = runFloor(run.first, run.second, balanced);
+        std::cout << std::setw(16) << (run.first == KitchenStation::LOCKED ? "locked" : "single-threaded")
+                  << std::setw(10) << run.second << std::setw(18) << std::fixed << std::setprecision(0)
+                  << rate / 1e3 << std::setw(12) << (balanced ? "balanced" : "OVERSOLD") << "\n";
+    }
+}
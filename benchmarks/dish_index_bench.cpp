@@ -0,0 +1,108 @@
+/**
+ * @file dish_index_bench.cpp
+ * @brief This file contains the dish index benchmark.
+ *
+ * A floor of 5,000 stations carries 50,000 distinct dishes, each on a handful of stations. Orders are checked
+ * with StationManager::canCompleteOrder, which asks only the stations indexed under the dish, and with a scan
+ * that asks every station in the list, as the manager did before the index. The scan is answered mostly by the
+ * stations' dish filters, whose false positive rate is reported.
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "Benchmark.hpp"
+#include "StationManager.hpp"
+
+namespace {
+
+const int kStations = 5000;
+const int kDishes = 50000;
+const int kStationsPerDish = 3;
+const int kSkus = 40;
+const int kOrders = 2000;
+volatile std::size_t g_sink;  // Keeps the answers from being optimized away
+
+} // namespace
+
+void benchDishIndex() {
+    std::mt19937 rng(235);
+    std::uniform_int_distribution<int> any_station(0, kStations - 1);
+    std::uniform_int_distribution<int> any_sku(0, kSkus - 1);
+    std::uniform_int_distribution<int> any_dish(0, kDishes - 1);
+
+    StationManager manager;
+    double build_ms = timeMs([&] {
+        for (int i = 0; i < kStations; i++) {
+            manager.addStation(new KitchenStation(stationName(i)));
+            for (int s = 0; s < kSkus; s++) {
+                if (s % 4 != i % 4) {  // Each station lacks a quarter of the SKUs
+                    manager.replenishIngredientAtStation(stationName(i), Ingredient("SKU " + std::to_string(s), 100, 0, 1.0));
+                }
+            }
+        }
+        for (int d = 0; d < kDishes; d++) {
+            std::vector<Ingredient> ingredients;
+            for (int k = 0; k < 3; k++) {
+                ingredients.emplace_back("SKU " + std::to_string(any_sku(rng)), 0, 1, 1.0);
+            }
+            for (int c = 0; c < kStationsPerDish; c++) {
+                manager.assignDishToStation(stationName(any_station(rng)), new Dish(dishName(d), ingredients));
+            }
+        }
+    });
+
+    std::vector<std::string> orders;
+    for (int i = 0; i < kOrders; i++) {
+        orders.push_back(i % 10 == 0 ? "Off the menu" : dishName(any_dish(rng)));
+    }
+
+    const StationManager& floor = manager;
+    std::size_t indexed_hits = 0;
+    double indexed_ms = timeMs([&] {
+        for (const std::string& order : orders) {
+            indexed_hits += floor.canCompleteOrder(order);
+        }
+    });
+    std::size_t scanned_hits = 0;
+    double scan_ms = timeMs([&] {
+        for (const std::string& order : orders) {
+            scanned_hits += std::any_of(floor.begin(), floor.end(), [&order](const KitchenStation* station) {
+                return station->canCompleteOrder(order);
+            });
+        }
+    });
+    g_sink = indexed_hits + scanned_hits;
+
+    KitchenStation::DishFilterStats filters{0, 0, 0, 0, 0};
+    for (const KitchenStation* station : floor) {
+        KitchenStation::DishFilterStats stats = station->getDishFilterStats();
+        filters.bits += stats.bits;
+        filters.names += stats.names;
+        filters.rejected += stats.rejected;
+        filters.false_positives += stats.false_positives;
+    }
+
+    std::cout << kStations << " stations, " << kDishes << " dishes on " << kStationsPerDish
+              << " stations each, built in " << std::fixed << std::setprecision(0) << build_ms << " ms; "
+              << indexed_hits << " of " << kOrders << " orders can be completed"
+              << (indexed_hits == scanned_hits ? "" : " (MISMATCH)") << "\n";
+    std::cout << std::setw(16) << "lookup" << std::setw(22) << "us / order" << "\n";
+    std::cout << std::setw(16) << "scan" << std::setw(22) << std::setprecision(2) << scan_ms * 1e3 / kOrders << "\n";
+    std::cout << std::setw(16) << "dish index" << std::setw(22) << indexed_ms * 1e3 / kOrders << "\n";
+    std::cout << "station dish filters: " << std::setprecision(1) << double(filters.bits) / filters.names
+              << " bits / name, " << filters.rejected << " misses rejected, " << filters.false_positives
+              << " false positives (" << std::setprecision(2)
+              << 100.0 * filters.false_positives / (filters.rejected + filters.false_positives) << "%)\n";
+
+    for (KitchenStation* station : manager) {
+        delete station;
+    }
+    manager.clear();
+}
@@ -0,0 +1,73 @@
+/**
+ * @file menu_bench.cpp
+ * @brief This file contains the available menu benchmark.
+ *
+ * A station carries 400 SKUs, some of them run out or low, and hundreds of dishes drawing on them. The menu of
+ * dishes it can prepare right now is computed with one canCompleteOrder call per dish and with the bulk
+ * getAvailableDishes query.
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "Benchmark.hpp"
+#include "KitchenStation.hpp"
+
+namespace {
+
+const int kSkus = 400;
+const int kIngredientsPerDish = 8;
+const int kRounds = 1000;
+volatile std::size_t g_sink;  // Keeps the menus from being optimized away
+
+} // namespace
+
+void benchMenu() {
+    std::cout << std::setw(8) << "dishes" << std::setw(12) << "available"
+              << std::setw(26) << "per dish (us / menu)" << std::setw(22) << "bulk (us / menu)" << "\n";
+
+    std::mt19937 rng(235);
+    std::uniform_int_distribution<int> any_sku(0, kSkus - 1);
+    for (int dish_count : {100, 300, 1000}) {
+        KitchenStation station("Prep");
+        // One SKU in ten is out, one in ten is low, the rest are plentiful
+        for (int s = 0; s < kSkus; s++) {
+            int quantity = s % 10 == 0 ? 0 : s % 10 == 1 ? 1 : 1000;
+            station.replenishStationIngredients(Ingredient("SKU " + std::to_string(s), quantity, 0, 1.0));
+        }
+        std::vector<std::string> dish_names;
+        for (int d = 0; d < dish_count; d++) {
+            std::vector<Ingredient> ingredients;
+            for (int i = 0; i < kIngredientsPerDish / 2 + d % (kIngredientsPerDish / 2 + 1); i++) {
+                ingredients.emplace_back("SKU " + std::to_string(any_sku(rng)), 0, 1 + i % 2, 1.0);
+            }
+            dish_names.push_back(dishName(d));
+            station.assignDishToStation(new Dish(dish_names.back(), ingredients));
+        }
+
+        std::size_t sink = 0;
+        double per_dish_ms = timeMs([&] {
+            for (int round = 0; round < kRounds; round++) {
+                for (const std::string& name : dish_names) {
+                    sink += station.canCompleteOrder(name);
+                }
+            }
+        });
+        std::size_t available = station.getAvailableDishes().size();
+        double bulk_ms = timeMs([&] {
+            for (int round = 0; round < kRounds; round++) {
+                sink += station.getAvailableDishes().size();
+            }
+        });
+        g_sink = sink;
+
+        std::cout << std::setw(8) << dish_count << std::setw(12) << available
+                  << std::setw(26) << std::fixed << std::setprecision(2) << per_dish_ms * 1e3 / kRounds
+                  << std::setw(22) << bulk_ms * 1e3 / kRounds << "\n";
+    }
+}
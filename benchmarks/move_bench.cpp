@@ -0,0 +1,135 @@
+/**
+ * @file move_bench.cpp
+ * @brief This file contains the payload copy benchmark for LinkedList.
+ *
+ * The payload is a Dish with a full ingredient list wrapped so that every copy and move is counted. The same
+ * work is done once with copies (insert of lvalues, getEntry into a local, copy construction of the list) and
+ * once with the move-aware API (emplace, moved pushBack, iteration by reference, move construction).
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Benchmark.hpp"
+#include "Dish.hpp"
+#include "LinkedList.hpp"
+
+namespace {
+
+const int kDishes = 20000;
+const int kIngredientsPerDish = 12;
+
+struct CopyCounts {
+    long copies = 0;
+    long moves = 0;
+};
+
+CopyCounts g_counts;
+volatile long g_sink;  // Keeps the reads from being optimized away
+
+// A Dish that reports every time it is copied or moved
+struct CountedDish {
+    Dish dish;
+
+    CountedDish(const std::string& name, const std::vector<Ingredient>& ingredients)
+        : dish(name, ingredients, 10, 9.99, Dish::CuisineType::FRENCH) {}
+    CountedDish(const CountedDish& other) : dish(other.dish) { g_counts.copies++; }
+    CountedDish(CountedDish&& other) noexcept : dish(std::move(other.dish)) { g_counts.moves++; }
+    CountedDish& operator=(const CountedDish& other) {
+        dish = other.dish;
+        g_counts.copies++;
+        return *this;
+    }
+    CountedDish& operator=(CountedDish&& other) noexcept {
+        dish = std::move(other.dish);
+        g_counts.moves++;
+        return *this;
+    }
+};
+
+std::vector<Ingredient> recipe() {
+    std::vector<Ingredient> ingredients;
+    for (int i = 0; i < kIngredientsPerDish; i++) {
+        ingredients.emplace_back("Ingredient number " + std::to_string(i), 100, 2, 0.25);
+    }
+    return ingredients;
+}
+
+void report(const char* phase, double ms) {
+    std::cout << std::setw(34) << phase
+              << std::setw(12) << g_counts.copies
+              << std::setw(12) << g_counts.moves
+              << std::setw(12) << std::fixed << std::setprecision(2) << ms << "\n";
+    g_counts = CopyCounts();
+}
+
+} // namespace
+
+void benchMove() {
+    const std::vector<Ingredient> ingredients = recipe();
+    std::cout << std::setw(34) << "phase" << std::setw(12) << "copies"
+              << std::setw(12) << "moves" << std::setw(12) << "ms" << "\n";
+
+    // Copying API
+    {
+        LinkedList<CountedDish> list;
+        double ms = timeMs([&] {
+            for (int i = 0; i < kDishes; i++) {
+                CountedDish dish("Dish", ingredients);
+                list.pushBack(dish);
+            }
+        });
+        report("build: pushBack(lvalue)", ms);
+
+        long total = 0;
+        ms = timeMs([&] {
+            for (int i = 0; i < kDishes; i += 100) {
+                CountedDish dish = list.getEntry(i);
+                total += dish.dish.getPrepTime();
+            }
+        });
+        report("read: local copy of getEntry", ms);
+
+        ms = timeMs([&] {
+            LinkedList<CountedDish> copy(list);
+            total += copy.getLength();
+        });
+        report("transfer: copy constructor", ms);
+        g_sink = total;
+    }
+
+    // Move-aware API
+    {
+        LinkedList<CountedDish> list;
+        double ms = timeMs([&] {
+            for (int i = 0; i < kDishes / 2; i++) {
+                list.emplace(list.getLength(), "Dish", ingredients);
+            }
+            for (int i = kDishes / 2; i < kDishes; i++) {
+                CountedDish dish("Dish", ingredients);
+                list.pushBack(std::move(dish));
+            }
+        });
+        report("build: emplace / pushBack(rvalue)", ms);
+
+        long total = 0;
+        ms = timeMs([&] {
+            for (const CountedDish& dish : list) {
+                total += dish.dish.getPrepTime();
+            }
+        });
+        report("read: range-for by reference", ms);
+
+        ms = timeMs([&] {
+            LinkedList<CountedDish> moved(std::move(list));
+            total += moved.getLength();
+        });
+        report("transfer: move constructor", ms);
+        g_sink = total;
+    }
+}
@@ -0,0 +1,138 @@
+/**
+ * @file pipeline_bench.cpp
+ * @brief This file contains the order pipeline benchmark.
+ *
+ * Request threads place orders for a dish at a named station on a floor in LOCKED mode, either by calling
+ * StationManager::prepareDishAtStation themselves or by submitting them to an OrderPipeline and collecting the
+ * outcomes through futures or callbacks. Throughput is reported for each, along with the share of orders prepared,
+ * and the stock of every station is checked against the orders reported prepared.
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#include <atomic>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Benchmark.hpp"
+#include "OrderPipeline.hpp"
+
+namespace {
+
+const int kStations = 64;
+const int kDishesPerStation = 8;
+const int kStock = 20000; // Of the single SKU each station's dishes draw on
+const int kProducers = 4;
+const std::size_t kWorkers = 4;
+const int kOrders = 200000; // Split among the producers
+volatile std::size_t g_sink;  // Keeps the answers from being optimized away
+
+/**
+ * How the request threads place their orders.
+ */
+enum class Placement { SYNCHRONOUS, FUTURES, CALLBACKS };
+
+void buildFloor(StationManager& manager) {
+    for (int i = 0; i < kStations; i++) {
+        manager.addStation(new KitchenStation(stationName(i)));
+        manager.replenishIngredientAtStation(stationName(i), Ingredient("SKU", kStock, 0, 1.0));
+        for (int d = 0; d < kDishesPerStation; d++) {
+            manager.assignDishToStation(stationName(i), new Dish(dishName(d), {Ingredient("SKU", 0, 1, 1.0)}));
+        }
+    }
+    manager.setConcurrencyMode(KitchenStation::LOCKED);
+}
+
+/**
+ * Places orders from several request threads.
+ * @return: Orders per second; prepared is set to the number of orders prepared.
+ */
+double placeOrders(Placement placement, std::size_t& prepared, bool& balanced) {
+    StationManager manager;
+    buildFloor(manager);
+    std::vector<std::string> stations;
+    std::vector<std::string> dishes;
+    for (int i = 0; i < kStations; i++) {
+        stations.push_back(stationName(i));
+    }
+    for (int d = 0; d < kDishesPerStation; d++) {
+        dishes.push_back(dishName(d));
+    }
+
+    std::atomic<std::size_t> done{0};
+    std::atomic<std::size_t> prepared_count{0};
+    double ms = timeMs([&] {
+        OrderPipeline* pipeline = placement == Placement::SYNCHRONOUS ? nullptr : new OrderPipeline(manager, kWorkers);
+        std::vector<std::thread> producers;
+        for (int p = 0; p < kProducers; p++) {
+            producers.emplace_back([&, p] {
+                std::mt19937 rng(100 + p);
+                std::vector<std::future<OrderPipeline::OrderResult>> outcomes;
+                for (int i = 0; i < kOrders / kProducers; i++) {
+                    const std::string& station = stations[rng() % kStations];
+                    const std::string& dish = dishes[rng() % kDishesPerStation];
+                    if (placement == Placement::SYNCHRONOUS) {
+                        prepared_count += manager.prepareDishAtStation(station, dish);
+                    } else if (placement == Placement::FUTURES) {
+                        outcomes.push_back(pipeline->submit(station, dish));
+                    } else {
+                        pipeline->submit(station, dish, 1, [&](const OrderPipeline::OrderResult& outcome) {
+                            prepared_count += outcome.result.status == KitchenStation::PrepareResult::PREPARED;
+                            done++;
+                        });
+                    }
+                }
+                for (auto& outcome : outcomes) {
+                    prepared_count += outcome.get().result.status == KitchenStation::PrepareResult::PREPARED;
+                }
+            });
+        }
+        for (std::thread& producer : producers) {
+            producer.join();
+        }
+        delete pipeline;  // Waits for the orders still in flight
+    });
+
+    prepared = prepared_count;
+    long long left = 0;
+    for (const KitchenStation* station : manager) {
+        for (const Ingredient& ingredient : station->getIngredientsStock()) {
+            left += ingredient.quantity;
+        }
+    }
+    balanced = left == static_cast<long long>(kStations) * kStock - static_cast<long long>(prepared) &&
+               (placement != Placement::CALLBACKS || done == static_cast<std::size_t>(kOrders / kProducers * kProducers));
+    g_sink = prepared;
+    for (KitchenStation* station : manager) {
+        delete station;
+    }
+    manager.clear();
+    return (kOrders / kProducers) * kProducers / (ms / 1e3);
+}
+
+} // namespace
+
+void benchPipeline() {
+    std::cout << kStations << " stations, " << kOrders << " orders from " << kProducers << " request threads, "
+              << kWorkers << " pipeline workers, " << std::thread::hardware_concurrency() << " hardware threads\n";
+    std::cout << std::setw(26) << "placement" << std::setw(18) << "k orders / s" << std::setw(12) << "prepared"
+              << std::setw(12) << "stock" << "\n";
+    const std::pair<Placement, const char*> placements[] = {
+        {Placement::SYNCHRONOUS, "prepareDishAtStation"},
+        {Placement::FUTURES, "pipeline, futures"},
+        {Placement::CALLBACKS, "pipeline, callbacks"},
+    };
+    for (const auto& placement : placements) {
+        std::size_t prepared = 0;
+        bool balanced = false;
+        double rate = placeOrders(placement.first, prepared, balanced);
+        std::cout << std::setw(26) << placement.second << std::setw(18) << std::fixed << std::setprecision(0)
+                  << rate / 1e3 << std::setw(11) << std::setprecision(1) << 100.0 * prepared / kOrders << "%"
+                  << std::setw(12) << (balanced ? "balanced" : "MISMATCH") << "\n";
+    }
+}
@@ -0,0 +1,100 @@
+/**
+ * @file policy_bench.cpp
+ * @brief This file contains the self-organizing station list benchmark.
+ *
+ * A Zipf-distributed stream of station lookups is replayed against the same floor under each access policy.
+ * For every policy it reports the average probe length (the 1-based position of the station at the time it
+ * was looked up) and the time spent in findStation.
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "StationManager.hpp"
+
+namespace {
+
+const int kStations = 1000;
+const int kLookups = 100000;
+const double kZipfExponent = 1.0;
+
+// Registers kStations stations; the caller owns them.
+void buildFloor(StationManager& manager, StationManager::AccessPolicy policy) {
+    manager.setAccessPolicy(policy);
+    for (int i = 0; i < kStations; i++) {
+        manager.addStation(new KitchenStation(stationName(i)));
+    }
+}
+
+void tearDown(StationManager& manager) {
+    for (KitchenStation* station : manager) {
+        delete station;
+    }
+    manager.clear();
+}
+
+} // namespace
+
+void benchPolicy() {
+    // Popularity rank r is drawn with weight 1 / r^s; ranks are scattered over the list order
+    std::vector<double> weights(kStations);
+    for (int rank = 0; rank < kStations; rank++) {
+        weights[rank] = 1.0 / std::pow(rank + 1, kZipfExponent);
+    }
+    std::vector<int> station_of_rank(kStations);
+    for (int i = 0; i < kStations; i++) {
+        station_of_rank[i] = i;
+    }
+    std::mt19937 rng(235);
+    std::shuffle(station_of_rank.begin(), station_of_rank.end(), rng);
+
+    std::discrete_distribution<int> zipf(weights.begin(), weights.end());
+    std::vector<std::string> stream;
+    stream.reserve(kLookups);
+    for (int i = 0; i < kLookups; i++) {
+        stream.push_back(stationName(station_of_rank[zipf(rng)]));
+    }
+
+    const std::pair<StationManager::AccessPolicy, const char*> policies[] = {
+        {StationManager::NONE, "none"},
+        {StationManager::MOVE_TO_FRONT, "move-to-front"},
+        {StationManager::TRANSPOSE, "transpose"},
+        {StationManager::COUNT_ORDERED, "count-ordered"},
+    };
+
+    std::cout << std::setw(16) << "policy" << std::setw(20) << "avg probe length"
+              << std::setw(14) << "ms" << "\n";
+    for (const auto& [policy, label] : policies) {
+        // Probe lengths are measured on one run, timing on an identical second run
+        StationManager probed;
+        buildFloor(probed, policy);
+        long long probes = 0;
+        for (const std::string& name : stream) {
+            auto it = std::find_if(probed.begin(), probed.end(),
+                                   [&name](const KitchenStation* station) { return station->getName() == name; });
+            probes += std::distance(probed.begin(), it) + 1;
+            probed.findStation(name);
+        }
+        tearDown(probed);
+
+        StationManager timed;
+        buildFloor(timed, policy);
+        double elapsed = timeMs([&] {
+            for (const std::string& name : stream) {
+                timed.findStation(name);
+            }
+        });
+        tearDown(timed);
+
+        std::cout << std::setw(16) << label
+                  << std::setw(20) << std::fixed << std::setprecision(1) << double(probes) / kLookups
+                  << std::setw(14) << std::setprecision(2) << elapsed << "\n";
+    }
+}
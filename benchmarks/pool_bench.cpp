@@ -0,0 +1,62 @@
+/**
+ * @file pool_bench.cpp
+ * @brief This file contains the node allocator benchmark.
+ *
+ * It runs the same insert/remove churn against a LinkedList that allocates every node with new and one that
+ * recycles nodes through PoolNodeAllocator, then prints the chunk usage of the pool.
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#include <iomanip>
+#include <iostream>
+#include "Benchmark.hpp"
+#include "LinkedList.hpp"
+
+namespace {
+
+const int kResident = 10000;  // entries kept in the list
+const int kRounds = 2000000;  // remove/insert pairs per run
+
+// Keeps kResident entries in the list and replaces one per round, alternating ends like station churn.
+template<class List>
+double churn(List& list) {
+    return timeMs([&] {
+        for (int i = 0; i < kResident; i++) {
+            list.pushBack(i);
+        }
+        for (int round = 0; round < kRounds; round++) {
+            list.erase(list.begin());
+            if (round % 2 == 0) {
+                list.pushBack(round);
+            } else {
+                list.pushFront(round);
+            }
+        }
+        list.clear();
+    });
+}
+
+} // namespace
+
+void benchPool() {
+    LinkedList<int> plain;
+    LinkedList<int, PoolNodeAllocator<int>> pooled;
+
+    double plain_ms = churn(plain);
+    double pooled_ms = churn(pooled);
+
+    std::cout << std::fixed << std::setprecision(1)
+              << std::setw(20) << "allocator" << std::setw(14) << "ms"
+              << std::setw(22) << "Mops (insert+remove)" << "\n"
+              << std::setw(20) << "new/delete" << std::setw(14) << plain_ms
+              << std::setw(22) << 2.0 * kRounds / plain_ms / 1000.0 << "\n"
+              << std::setw(20) << "pool" << std::setw(14) << pooled_ms
+              << std::setw(22) << 2.0 * kRounds / pooled_ms / 1000.0 << "\n";
+
+    PoolStats stats = pooled.getAllocator().getStats();
+    std::cout << "pool: " << stats.chunk_count << " chunks x " << stats.nodes_per_chunk << " nodes, "
+              << stats.nodes_in_use << " in use, " << stats.nodes_free << " free, "
+              << stats.allocations << " allocations (" << stats.recycled << " recycled)\n";
+}
@@ -0,0 +1,143 @@
+/**
+ * @file reservation_bench.cpp
+ * @brief This file contains the contended reservation benchmark.
+ *
+ * A single busy station, the grill, carries 16 dishes that all draw on the same 4 ingredients. Up to 32 threads fire
+ * orders at it, with a few restocks mixed in, once with the station in LOCKED mode, where every order holds the
+ * station alone, and once in LOCK_FREE mode, where orders reserve the shared ingredients with compare-and-swap. The
+ * stock is checked for overselling after each run, as in the concurrency benchmark.
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "Benchmark.hpp"
+#include "KitchenStation.hpp"
+
+namespace {
+
+const int kDishes = 16;
+const int kSkus = 4; // Every dish draws on three of them
+const int kStock = 2000; // Consumption about matches the restocks, so the ingredients run short now and then
+const int kRestock = 40;
+const int kOrders = 800000; // Split among the threads
+volatile std::size_t g_sink;  // Keeps the answers from being optimized away
+
+std::string skuName(int index) {
+    return "SKU " + std::to_string(index);
+}
+
+/**
+ * What one thread saw happen, by SKU.
+ */
+struct Tally {
+    std::vector<long long> consumed = std::vector<long long>(kSkus, 0);
+    std::vector<long long> restocked = std::vector<long long>(kSkus, 0);
+    std::size_t prepared = 0;
+};
+
+void fireOrders(KitchenStation& grill, const std::vector<Symbol>& dishes,
+                const std::vector<std::vector<std::pair<int, int>>>& recipes, int orders, unsigned seed, Tally& tally) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> any_dish(0, kDishes - 1);
+    std::uniform_int_distribution<int> any_sku(0, kSkus - 1);
+    std::uniform_int_distribution<int> any_kind(0, 99);
+    for (int i = 0; i < orders; i++) {
+        if (any_kind(rng) < 90) {
+            int dish = any_dish(rng);
+            if (grill.tryPrepareDish(dishes[dish]).status == KitchenStation::PrepareResult::PREPARED) {
+                tally.prepared++;
+                for (const auto& step : recipes[dish]) {
+                    tally.consumed[step.first] += step.second;
+                }
+            }
+        } else {
+            int sku = any_sku(rng);
+            grill.replenishStationIngredients(Ingredient(skuName(sku), kRestock, 0, 1.0));
+            tally.restocked[sku] += kRestock;
+        }
+    }
+}
+
+/**
+ * Runs the orders on a fresh grill.
+ * @return: Orders per second.
+ */
+double runGrill(KitchenStation::ConcurrencyMode mode, int threads, bool& balanced, double& prepared_share) {
+    std::mt19937 rng(235);
+    KitchenStation grill("Grill");
+    std::vector<Symbol> dishes;
+    std::vector<std::vector<std::pair<int, int>>> recipes;
+    for (int s = 0; s < kSkus; s++) {
+        grill.replenishStationIngredients(Ingredient(skuName(s), kStock, 0, 1.0));
+    }
+    for (int d = 0; d < kDishes; d++) {
+        recipes.emplace_back();
+        std::vector<Ingredient> ingredients;
+        for (int k = 0; k < 3; k++) {
+            int sku = (d + k) % kSkus;  // Distinct SKUs, so that the serial and reserved deductions agree
+            recipes.back().emplace_back(sku, 1 + static_cast<int>(rng() % 2));
+            ingredients.emplace_back(skuName(sku), 0, recipes.back().back().second, 1.0);
+        }
+        grill.assignDishToStation(new Dish(dishName(d), ingredients));
+        dishes.push_back(Symbol(dishName(d)));
+    }
+    grill.setConcurrencyMode(mode);
+
+    std::vector<Tally> tallies(threads);
+    double ms = timeMs([&] {
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; t++) {
+            workers.emplace_back(fireOrders, std::ref(grill), std::cref(dishes), std::cref(recipes),
+                                 kOrders / threads, 100u + t, std::ref(tallies[t]));
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    });
+
+    std::vector<long long> expected(kSkus, kStock);
+    std::size_t prepared = 0;
+    for (const Tally& tally : tallies) {
+        for (int s = 0; s < kSkus; s++) {
+            expected[s] += tally.restocked[s] - tally.consumed[s];
+        }
+        prepared += tally.prepared;
+    }
+    std::vector<long long> actual(kSkus, 0);
+    for (const Ingredient& ingredient : grill.getIngredientsStock()) {
+        actual[std::stoi(ingredient.name.str().substr(4))] = ingredient.quantity;
+    }
+    balanced = actual == expected;
+    prepared_share = 100.0 * prepared / ((kOrders / threads) * threads);
+    g_sink = prepared;
+    return (kOrders / threads) * threads / (ms / 1e3);
+}
+
+} // namespace
+
+void benchReservations() {
+    std::cout << "1 station, " << kDishes << " dishes on " << kSkus << " shared ingredients, " << kOrders
+              << " orders (90% preparations, 10% restocks), " << std::thread::hardware_concurrency()
+              << " hardware threads\n";
+    std::cout << std::setw(12) << "mode" << std::setw(10) << "threads" << std::setw(18) << "k orders / s"
+              << std::setw(12) << "prepared" << std::setw(12) << "stock" << "\n";
+    for (int threads : {1, 16, 32}) {
+        for (KitchenStation::ConcurrencyMode mode : {KitchenStation::LOCKED, KitchenStation::LOCK_FREE}) {
+            bool balanced = false;
+            double prepared_share = 0;
+            double rate = runGrill(mode, threads, balanced, prepared_share);
+            std::cout << std::setw(12) << (mode == KitchenStation::LOCKED ? "locked" : "lock-free") << std::setw(10)
+                      << threads << std::setw(18) << std::fixed << std::setprecision(0) << rate / 1e3
+                      << std::setw(11) << std::setprecision(1) << prepared_share << "%" << std::setw(12)
+                      << (balanced ? "balanced" : "OVERSOLD") << "\n";
+        }
+    }
+}
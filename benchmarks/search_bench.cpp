@@ -0,0 +1,101 @@
+/**
+ * @file search_bench.cpp
+ * @brief This file contains the parallel order search benchmark.
+ *
+ * Floors of a growing number of stations all carry one dish, and all but a few are out of its ingredient, as when a
+ * chain asks whether a dish is available anywhere. canCompleteOrder is timed on the calling thread alone and with a
+ * ThreadPool, for a miss (no able station), a late hit (the one able station is the last asked) and the list of every
+ * able station. Every floor sets its parallel search threshold to 0, so that the pool takes every search given it;
+ * the size from which the pool column beats the serial one is the threshold worth setting on that machine, in place
+ * of the default, StationManager::DEFAULT_PARALLEL_SEARCH (SERIAL_SEARCH on a single hardware thread).
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Benchmark.hpp"
+#include "StationManager.hpp"
+
+namespace {
+
+const int kFloorSizes[] = {1024, 4096, 16384, 65536};
+const std::size_t kPoolThreads = 3; // Besides the caller
+const int kAbleEvery = 64; // In the "every able station" search, one station in this many has stock
+const int kWork = 1 << 22; // Stations asked per timing, split into queries
+volatile std::size_t g_sink;  // Keeps the answers from being optimized away
+
+/**
+ * Builds a floor whose stations all carry the dish, none with stock of it.
+ */
+void buildFloor(StationManager& manager, int stations) {
+    for (int i = 0; i < stations; i++) {
+        manager.addStation(new KitchenStation(stationName(i)));
+        manager.replenishIngredientAtStation(stationName(i), Ingredient("SKU", 0, 0, 1.0));
+        manager.assignDishToStation(stationName(i), new Dish(dishName(0), {Ingredient("SKU", 0, 1, 1.0)}));
+    }
+}
+
+/**
+ * @return: Microseconds per query.
+ */
+template<class Query>
+double timeQueries(int stations, Query&& query) {
+    const int queries = std::max(1, kWork / stations);
+    double ms = timeMs([&] {
+        for (int q = 0; q < queries; q++) {
+            g_sink = g_sink + query();
+        }
+    });
+    return ms * 1e3 / queries;
+}
+
+} // namespace
+
+void benchSearch() {
+    ThreadPool serial(0);
+    ThreadPool pool(kPoolThreads);
+    const Symbol dish(dishName(0));
+    std::cout << "1 + " << kPoolThreads << " search threads, " << std::thread::hardware_concurrency()
+              << " hardware threads\n";
+    std::cout << std::setw(10) << "stations" << std::setw(16) << "miss serial" << std::setw(16) << "miss pool"
+              << std::setw(16) << "late serial" << std::setw(16) << "late pool" << std::setw(15) << "all serial"
+              << std::setw(15) << "all pool" << "   (us / query)\n";
+    for (int stations : kFloorSizes) {
+        StationManager manager;
+        buildFloor(manager, stations);
+        manager.setParallelSearchThreshold(0);
+        auto any = [&](ThreadPool& threads) {
+            return [&] { return static_cast<std::size_t>(manager.canCompleteOrder(dish, threads)); };
+        };
+        auto all = [&](ThreadPool& threads) {
+            return [&] { return manager.findStationsForOrder(dish, threads).size(); };
+        };
+        const double miss_serial = timeQueries(stations, any(serial));
+        const double miss_pool = timeQueries(stations, any(pool));
+        // Stock for the station asked last only: the dish index lists stations in the order they took the dish
+        manager.replenishIngredientAtStation(stationName(stations - 1), Ingredient("SKU", 1000, 0, 1.0));
+        const double late_serial = timeQueries(stations, any(serial));
+        const double late_pool = timeQueries(stations, any(pool));
+        for (int i = 0; i < stations; i += kAbleEvery) {
+            manager.replenishIngredientAtStation(stationName(i), Ingredient("SKU", 1000, 0, 1.0));
+        }
+        const std::size_t found_serial = all(serial)();
+        const std::size_t found_pool = all(pool)();
+        const double all_serial = timeQueries(stations, all(serial));
+        const double all_pool = timeQueries(stations, all(pool));
+        std::cout << std::setw(10) << stations << std::fixed << std::setprecision(1) << std::setw(16) << miss_serial
+                  << std::setw(16) << miss_pool << std::setw(16) << late_serial << std::setw(16) << late_pool
+                  << std::setw(15) << all_serial << std::setw(15) << all_pool
+                  << (found_serial == found_pool ? "" : "   MISMATCH") << "\n";
+        for (KitchenStation* station : manager) {
+            delete station;
+        }
+        manager.clear();
+    }
+}
@@ -0,0 +1,80 @@
+/**
+ * @file skiplist_bench.cpp
+ * @brief This file contains the skip list benchmark.
+ *
+ * The LinkedList, the UnrolledList and the SkipList are filled with the same stations, then each one answers the
+ * same random positional reads (getEntry) and absorbs the same random positional inserts and removals.
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "StationManager.hpp"
+
+namespace {
+
+const int kOperations = 20000;
+volatile std::uintptr_t g_sink;  // Keeps the reads from being optimized away
+
+template<class List>
+void measure(const char* label, const std::vector<KitchenStation*>& stations, const std::vector<int>& positions) {
+    List list;
+    for (KitchenStation* station : stations) {
+        list.pushBack(station);
+    }
+
+    std::uintptr_t sum = 0;
+    double read_ms = timeMs([&] {
+        for (int position : positions) {
+            sum += reinterpret_cast<std::uintptr_t>(list.getEntry(position));
+        }
+    });
+    g_sink = sum;
+
+    // each removal is paired with an insert so the length, and the valid positions, stay put
+    double update_ms = timeMs([&] {
+        for (std::size_t i = 0; i < positions.size(); i++) {
+            KitchenStation* station = list.getEntry(positions[i]);
+            list.remove(positions[i]);
+            list.insert(positions[positions.size() - 1 - i], station);
+        }
+    });
+
+    std::cout << std::setw(10) << stations.size() << std::setw(16) << label
+              << std::setw(22) << std::fixed << std::setprecision(1) << read_ms * 1e6 / kOperations
+              << std::setw(26) << std::setprecision(1) << update_ms * 1e6 / kOperations << "\n";
+}
+
+} // namespace
+
+void benchSkipList() {
+    std::cout << std::setw(10) << "stations" << std::setw(16) << "list"
+              << std::setw(22) << "getEntry (ns / op)" << std::setw(26) << "remove+insert (ns / op)" << "\n";
+
+    std::mt19937 rng(235);
+    for (int count : {1000, 5000, 20000}) {
+        std::vector<KitchenStation*> stations;
+        for (int i = 0; i < count; i++) {
+            stations.push_back(new KitchenStation(stationName(i)));
+        }
+        std::vector<int> positions;
+        for (int i = 0; i < kOperations; i++) {
+            positions.push_back(std::uniform_int_distribution<int>(0, count - 1)(rng));
+        }
+
+        measure<StationList>("linked", stations, positions);
+        measure<UnrolledStationList>("unrolled", stations, positions);
+        measure<SkipStationList>("skip", stations, positions);
+
+        for (KitchenStation* station : stations) {
+            delete station;
+        }
+    }
+}
@@ -0,0 +1,194 @@
+/**
+ * @file stealing_bench.cpp
+ * @brief This file contains the work-stealing benchmark.
+ *
+ * Request threads submit orders to an OrderPipeline in paced bursts, half of them to one hot station and the rest
+ * spread over the others. Under PINNED scheduling the quiet stations that share a worker with the hot one wait behind
+ * its batches; under WORK_STEALING the other workers take their lanes. The latency of each order, from its submission
+ * to its callback, is reported as percentiles for every order and for those of the quiet stations alone, and the
+ * stock of every station is checked against the orders reported prepared. The two schedulings take turns over several
+ * runs, and the median of each figure is reported, as a single run is at the mercy of the OS scheduler.
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Benchmark.hpp"
+#include "OrderPipeline.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const int kStations = 64;
+const int kDishesPerStation = 4;
+const int kSkusPerDish = 12; // So that an order costs more than its trip through the pipeline
+const int kStock = 1000000;
+const int kHotStation = 0;
+const int kHotPercent = 50;
+const int kProducers = 2;
+const std::size_t kWorkers = 4;
+const int kBursts = 100; // Per producer
+const int kBurst = 128; // Orders submitted back to back before the producer pauses
+const std::chrono::microseconds kPause(1000);
+const int kRuns = 5; // Per scheduling, alternating; the median of each figure is reported
+volatile std::size_t g_sink;  // Keeps the answers from being optimized away
+
+void buildFloor(StationManager& manager) {
+    for (int i = 0; i < kStations; i++) {
+        manager.addStation(new KitchenStation(stationName(i)));
+        std::vector<Ingredient> recipe;
+        for (int k = 0; k < kSkusPerDish; k++) {
+            std::string sku = "SKU " + std::to_string(k);
+            manager.replenishIngredientAtStation(stationName(i), Ingredient(sku, kStock, 0, 1.0));
+            recipe.push_back(Ingredient(sku, 0, 1, 1.0));
+        }
+        for (int d = 0; d < kDishesPerStation; d++) {
+            manager.assignDishToStation(stationName(i), new Dish(dishName(d), recipe));
+        }
+    }
+    manager.setConcurrencyMode(KitchenStation::LOCKED);
+}
+
+/**
+ * The latency percentiles of a set of orders, in microseconds.
+ */
+struct Percentiles {
+    double p50;
+    double p99;
+    double p999;
+};
+
+Percentiles percentiles(std::vector<double> latencies) {
+    std::sort(latencies.begin(), latencies.end());
+    auto at = [&](double share) {
+        return latencies[std::min(latencies.size() - 1, static_cast<std::size_t>(share * latencies.size()))];
+    };
+    return Percentiles{at(0.50), at(0.99), at(0.999)};
+}
+
+/**
+ * Runs the skewed load through a pipeline.
+ * @return: Orders per second; all and cold are set to the latencies of every order and of the quiet stations' ones.
+ */
+double runSkewed(OrderScheduling::Scheduling scheduling, Percentiles& all, Percentiles& cold, bool& balanced) {
+    StationManager manager;
+    buildFloor(manager);
+    std::vector<std::string> stations;
+    std::vector<std::string> dishes;
+    for (int i = 0; i < kStations; i++) {
+        stations.push_back(stationName(i));
+    }
+    for (int d = 0; d < kDishesPerStation; d++) {
+        dishes.push_back(dishName(d));
+    }
+
+    const std::size_t orders = static_cast<std::size_t>(kProducers) * kBursts * kBurst;
+    std::vector<Clock::time_point> submitted(orders);
+    std::vector<double> latency(orders); // Microseconds; each slot written by the one callback of its order
+    std::vector<char> hot(orders);
+    std::atomic<std::size_t> prepared{0};
+    double ms = timeMs([&] {
+        OrderPipeline pipeline(manager, kWorkers, scheduling);
+        std::vector<std::thread> producers;
+        for (int p = 0; p < kProducers; p++) {
+            producers.emplace_back([&, p] {
+                std::mt19937 rng(300 + p);
+                std::size_t order = static_cast<std::size_t>(p) * kBursts * kBurst;
+                for (int b = 0; b < kBursts; b++) {
+                    for (int i = 0; i < kBurst; i++, order++) {
+                        const bool to_hot = static_cast<int>(rng() % 100) < kHotPercent;
+                        const int station = to_hot ? kHotStation : 1 + static_cast<int>(rng() % (kStations - 1));
+                        hot[order] = to_hot;
+                        submitted[order] = Clock::now();
+                        pipeline.submit(stations[station], dishes[rng() % kDishesPerStation], 1,
+                                        [&, order](const OrderPipeline::OrderResult& outcome) {
+                            latency[order] = std::chrono::duration<double, std::micro>(Clock::now() -
+                                                                                       submitted[order]).count();
+                            prepared += outcome.result.status == KitchenStation::PrepareResult::PREPARED;
+                        });
+                    }
+                    std::this_thread::sleep_for(kPause);
+                }
+            });
+        }
+        for (std::thread& producer : producers) {
+            producer.join();
+        }
+    });  // The pipeline's destructor waits for the orders still in flight
+
+    std::vector<double> cold_latency;
+    for (std::size_t i = 0; i < orders; i++) {
+        if (!hot[i]) {
+            cold_latency.push_back(latency[i]);
+        }
+    }
+    all = percentiles(latency);
+    cold = percentiles(cold_latency);
+
+    long long left = 0;
+    for (const KitchenStation* station : manager) {
+        for (const Ingredient& ingredient : station->getIngredientsStock()) {
+            left += ingredient.quantity;
+        }
+    }
+    balanced = left == (static_cast<long long>(kStations) * kStock - static_cast<long long>(prepared)) * kSkusPerDish;
+    g_sink = prepared;
+    for (KitchenStation* station : manager) {
+        delete station;
+    }
+    manager.clear();
+    return orders / (ms / 1e3);
+}
+
+} // namespace
+
+void benchStealing() {
+    std::cout << kStations << " stations, " << kHotPercent << "% of the orders to one of them, "
+              << kProducers * kBursts * kBurst << " orders in bursts of " << kBurst << ", " << kWorkers
+              << " pipeline workers, " << std::thread::hardware_concurrency() << " hardware threads, median of "
+              << kRuns << " runs\n";
+    std::cout << std::setw(16) << "scheduling" << std::setw(14) << "k orders / s" << std::setw(10) << "p50 us"
+              << std::setw(10) << "p99 us" << std::setw(12) << "p99.9 us"
+              << std::setw(15) << "cold p99 us" << std::setw(17) << "cold p99.9 us" << std::setw(12) << "stock"
+              << "\n";
+    const std::pair<OrderScheduling::Scheduling, const char*> schedulings[] = {
+        {OrderScheduling::PINNED, "pinned"},
+        {OrderScheduling::WORK_STEALING, "work stealing"},
+    };
+    std::vector<double> figures[2][6];
+    bool balanced[2] = {true, true};
+    for (int run = 0; run < kRuns; run++) {
+        for (int s = 0; s < 2; s++) {
+            Percentiles all{};
+            Percentiles cold{};
+            bool run_balanced = false;
+            const double run_figures[6] = {runSkewed(schedulings[s].first, all, cold, run_balanced), all.p50, all.p99,
+                                           all.p999, cold.p99, cold.p999};
+            for (int f = 0; f < 6; f++) {
+                figures[s][f].push_back(run_figures[f]);
+            }
+            balanced[s] = balanced[s] && run_balanced;
+        }
+    }
+    for (int s = 0; s < 2; s++) {
+        double median[6];
+        for (int f = 0; f < 6; f++) {
+            std::sort(figures[s][f].begin(), figures[s][f].end());
+            median[f] = figures[s][f][kRuns / 2];
+        }
+        std::cout << std::setw(16) << schedulings[s].second << std::setw(14) << std::fixed << std::setprecision(0)
+                  << median[0] / 1e3 << std::setw(10) << median[1] << std::setw(10) << median[2] << std::setw(12)
+                  << median[3] << std::setw(15) << median[4] << std::setw(17) << median[5] << std::setw(12)
+                  << (balanced[s] ? "balanced" : "MISMATCH") << "\n";
+    }
+}
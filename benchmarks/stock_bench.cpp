@@ -0,0 +1,90 @@
+/**
+ * @file stock_bench.cpp
+ * @brief This file contains the ingredient stock benchmark.
+ *
+ * A single station is stocked with a growing number of SKUs and assigned dishes that each draw a few random
+ * ingredients from it. The stock is deep enough that nothing runs out, so every order takes the full path:
+ * replenishing every SKU, checking every dish, and preparing every dish.
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "Benchmark.hpp"
+#include "KitchenStation.hpp"
+
+namespace {
+
+const int kDishes = 50;
+const int kIngredientsPerDish = 8;
+const int kRounds = 200;
+volatile bool g_sink;  // Keeps the checks from being optimized away
+
+std::string skuName(int index) {
+    return "SKU " + std::to_string(index);
+}
+
+} // namespace
+
+void benchStock() {
+    std::cout << std::setw(8) << "SKUs" << std::setw(24) << "replenish (ns / op)"
+              << std::setw(28) << "canCompleteOrder (ns / op)" << std::setw(24) << "prepareDish (ns / op)" << "\n";
+
+    std::mt19937 rng(235);
+    for (int sku_count : {25, 100, 400, 1600}) {
+        KitchenStation station("Prep");
+        std::vector<std::string> dish_names;
+        std::uniform_int_distribution<int> any_sku(0, sku_count - 1);
+        for (int d = 0; d < kDishes; d++) {
+            std::vector<Ingredient> ingredients;
+            for (int i = 0; i < kIngredientsPerDish; i++) {
+                ingredients.emplace_back(skuName(any_sku(rng)), 0, 1, 1.0);
+            }
+            dish_names.push_back(dishName(d));
+            station.assignDishToStation(new Dish(dish_names.back(), ingredients));
+        }
+
+        std::vector<Ingredient> deliveries;
+        for (int s = 0; s < sku_count; s++) {
+            deliveries.emplace_back(skuName(s), 1000000, 0, 1.0);
+        }
+
+        double replenish_ms = timeMs([&] {
+            for (int round = 0; round < kRounds; round++) {
+                for (const Ingredient& delivery : deliveries) {
+                    station.replenishStationIngredients(delivery);
+                }
+            }
+        });
+
+        bool sink = false;
+        double check_ms = timeMs([&] {
+            for (int round = 0; round < kRounds; round++) {
+                for (const std::string& name : dish_names) {
+                    sink ^= station.canCompleteOrder(name);
+                }
+            }
+        });
+        g_sink = sink;
+
+        double prepare_ms = timeMs([&] {
+            for (int round = 0; round < kRounds; round++) {
+                for (const std::string& name : dish_names) {
+                    station.prepareDish(name);
+                }
+            }
+        });
+
+        const double replenishes = double(kRounds) * sku_count;
+        const double orders = double(kRounds) * kDishes;
+        std::cout << std::setw(8) << sku_count
+                  << std::setw(24) << std::fixed << std::setprecision(1) << replenish_ms * 1e6 / replenishes
+                  << std::setw(28) << check_ms * 1e6 / orders
+                  << std::setw(24) << prepare_ms * 1e6 / orders << "\n";
+    }
+}
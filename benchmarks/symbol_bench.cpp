@@ -0,0 +1,96 @@
+/**
+ * @file symbol_bench.cpp
+ * @brief This file contains the interned name benchmark.
+ *
+ * A menu of 50,000 dishes draws on 400 ingredients. The memory its ingredient names take is compared with what one
+ * std::string per recipe entry would take, and a station's orders are checked by name and by symbol.
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "Benchmark.hpp"
+#include "KitchenStation.hpp"
+#include "Symbol.hpp"
+
+namespace {
+
+const int kDishes = 50000;
+const int kSkus = 400;
+const int kIngredientsPerDish = 8;
+const int kStationDishes = 1000;
+const int kRounds = 200;
+volatile std::size_t g_sink;  // Keeps the checks from being optimized away
+
+// Long enough that std::string keeps it on the heap
+std::string ingredientName(int index) {
+    return "Heirloom Tomato Variety " + std::to_string(index);
+}
+
+} // namespace
+
+void benchSymbols() {
+    std::mt19937 rng(235);
+    std::uniform_int_distribution<int> any_sku(0, kSkus - 1);
+
+    const std::size_t symbols_before = Symbol::tableSize();
+    std::vector<std::vector<Ingredient>> recipes(kDishes);
+    std::size_t string_bytes = 0;  // What the names would take as one std::string each
+    for (std::vector<Ingredient>& recipe : recipes) {
+        for (int i = 0; i < kIngredientsPerDish; i++) {
+            std::string name = ingredientName(any_sku(rng));
+            string_bytes += sizeof(std::string) + (name.size() > 15 ? name.size() + 1 : 0);
+            recipe.emplace_back(name, 0, 1, 1.0);
+        }
+    }
+    std::size_t table_bytes = 0;
+    for (int s = 0; s < kSkus; s++) {
+        table_bytes += sizeof(std::string) + ingredientName(s).size() + 1;
+    }
+    const std::size_t symbol_bytes = std::size_t(kDishes) * kIngredientsPerDish * sizeof(Symbol) + table_bytes;
+    std::cout << kDishes << " dishes x " << kIngredientsPerDish << " ingredients, "
+              << Symbol::tableSize() - symbols_before << " names interned\n";
+    std::cout << std::setw(16) << "names" << std::setw(16) << "KiB" << "\n";
+    std::cout << std::setw(16) << "std::string" << std::setw(16) << string_bytes / 1024 << "\n";
+    std::cout << std::setw(16) << "Symbol" << std::setw(16) << symbol_bytes / 1024 << "\n";
+
+    KitchenStation station("Prep");
+    for (int s = 0; s < kSkus; s++) {
+        station.replenishStationIngredients(Ingredient(ingredientName(s), s % 10 == 0 ? 0 : 1000, 0, 1.0));
+    }
+    std::vector<std::string> names;
+    std::vector<Symbol> symbols;
+    for (int d = 0; d < kStationDishes; d++) {
+        names.push_back(dishName(d));
+        symbols.push_back(Symbol(names.back()));
+        station.assignDishToStation(new Dish(names.back(), recipes[d]));
+    }
+
+    std::size_t sink = 0;
+    double by_name_ms = timeMs([&] {
+        for (int round = 0; round < kRounds; round++) {
+            for (const std::string& name : names) {
+                sink += station.canCompleteOrder(name);
+            }
+        }
+    });
+    double by_symbol_ms = timeMs([&] {
+        for (int round = 0; round < kRounds; round++) {
+            for (Symbol symbol : symbols) {
+                sink += station.canCompleteOrder(symbol);
+            }
+        }
+    });
+    g_sink = sink;
+
+    const double orders = double(kRounds) * kStationDishes;
+    std::cout << std::setw(16) << "order check" << std::setw(16) << "ns / order" << "\n";
+    std::cout << std::setw(16) << "by name" << std::setw(16) << std::fixed << std::setprecision(1)
+              << by_name_ms * 1e6 / orders << "\n";
+    std::cout << std::setw(16) << "by symbol" << std::setw(16) << by_symbol_ms * 1e6 / orders << "\n";
+}
@@ -0,0 +1,75 @@
+/**
+ * @file unrolled_bench.cpp
+ * @brief This file contains the unrolled list benchmark.
+ *
+ * The node-per-item LinkedList and the UnrolledList are both filled by positional inserts at random positions,
+ * which also leaves the linked nodes scattered over the heap the way a long-running floor does. Then both are
+ * traversed end to end several times.
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "StationManager.hpp"
+
+namespace {
+
+const int kTraversals = 50;
+volatile std::uintptr_t g_sink;  // Keeps the traversals from being optimized away
+
+template<class List>
+void measure(const char* label, int count, const std::vector<int>& positions,
+             const std::vector<KitchenStation*>& stations) {
+    List list;
+    double insert_ms = timeMs([&] {
+        for (int i = 0; i < count; i++) {
+            list.insert(positions[i], stations[i]);
+        }
+    });
+
+    std::uintptr_t sum = 0;
+    double traverse_ms = timeMs([&] {
+        for (int round = 0; round < kTraversals; round++) {
+            for (KitchenStation* station : list) {
+                sum += reinterpret_cast<std::uintptr_t>(station);
+            }
+        }
+    });
+    g_sink = sum;
+
+    std::cout << std::setw(10) << count << std::setw(16) << label
+              << std::setw(22) << std::fixed << std::setprecision(2) << insert_ms
+              << std::setw(26) << std::setprecision(2) << traverse_ms * 1e6 / (double(kTraversals) * count) << "\n";
+}
+
+} // namespace
+
+void benchUnrolled() {
+    std::cout << std::setw(10) << "stations" << std::setw(16) << "list"
+              << std::setw(22) << "random inserts (ms)" << std::setw(26) << "traversal (ns / station)" << "\n";
+
+    std::mt19937 rng(235);
+    for (int count : {1000, 5000, 20000}) {
+        std::vector<KitchenStation*> stations;
+        std::vector<int> positions;
+        for (int i = 0; i < count; i++) {
+            stations.push_back(new KitchenStation(stationName(i)));
+            positions.push_back(std::uniform_int_distribution<int>(0, i)(rng));
+        }
+
+        measure<StationList>("linked", count, positions, stations);
+        measure<UnrolledStationList>("unrolled", count, positions, stations);
+
+        for (KitchenStation* station : stations) {
+            delete station;
+        }
+    }
+    std::cout << "unrolled block: " << UnrolledStationList::Block::CAPACITY << " stations in "
+              << sizeof(UnrolledStationList::Block) << " bytes\n";
+}
@@ -0,0 +1,147 @@
+/**
+ * @file alloc_test.cpp
+ * @brief This file contains the order path allocation test, a program of its own.
+ *
+ * The global operator new and operator delete of this program are replaced here by versions that count every
+ * allocation, so the test runs apart from the benchmarks. A floor takes a round of orders to warm up (stations hit
+ * for the first time, symbols interned), then the same mix again while counting: checks by name and by symbol,
+ * preparations and serving counts, and walks over the stock and dish views. The order path must not allocate at
+ * all: any allocation fails the test with a nonzero exit status.
+ *
+ * @date 10/16/2026
+ * @author Mitchell Lipyansky
+*/
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+#include "StationManager.hpp"
+#include "benchmarks/Benchmark.hpp"  // For stationName and dishName
+
+namespace {
+
+std::atomic<std::size_t> g_allocations(0);  // Every operator new in the program
+volatile std::size_t g_sink;  // Keeps the orders from being optimized away
+
+const int kStations = 50;
+const int kDishesPerStation = 20;
+const int kSkus = 30;
+const int kRounds = 20;
+
+/**
+ * Places the same mix of orders on the floor.
+ * @param manager The floor.
+ * @param dish_names The names of the dishes on the menu, with their symbols.
+ * @return: A checksum of the answers.
+ */
+std::size_t placeOrders(StationManager& manager, const std::vector<std::string>& dish_names,
+                        const std::vector<Symbol>& dish_symbols, const std::vector<std::string>& station_names) {
+    const StationManager& floor = manager;
+    std::size_t sum = 0;
+    for (int round = 0; round < kRounds; round++) {
+        for (std::size_t d = 0; d < dish_names.size(); d++) {
+            sum += floor.canCompleteOrder(dish_names[d]);
+            sum += manager.canCompleteOrder(dish_symbols[d]);
+            const std::string& station = station_names[(d + round) % station_names.size()];
+            sum += manager.prepareDishAtStation(station, dish_names[d]);
+            sum += manager.prepareDishAtStation(station, dish_names[d], 3);
+            sum += manager.maxServingsAtStation(station, dish_names[d]) > 0;
+        }
+        sum += manager.canCompleteOrder("Off the menu");
+        for (const KitchenStation* station : floor) {
+            for (const Ingredient& ingredient : station->viewIngredientsStock()) {
+                sum += ingredient.quantity > 0;
+            }
+            for (const Dish* dish : station->viewDishes()) {
+                sum += dish->viewIngredients().size();
+            }
+        }
+    }
+    return sum;
+}
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+int main() {
+    bool failed = false;
+    std::vector<std::string> station_names;
+    std::vector<std::string> dish_names;
+    std::vector<Symbol> dish_symbols;
+    for (int i = 0; i < kStations; i++) {
+        station_names.push_back(stationName(i));
+    }
+    for (int d = 0; d < kDishesPerStation * 2; d++) {
+        dish_names.push_back(dishName(d));
+        dish_symbols.push_back(Symbol(dish_names.back()));
+    }
+
+    for (StationAccessPolicy::AccessPolicy policy :
+         {StationAccessPolicy::NONE, StationAccessPolicy::MOVE_TO_FRONT, StationAccessPolicy::TRANSPOSE,
+          StationAccessPolicy::COUNT_ORDERED}) {
+        StationManager manager;
+        manager.setAccessPolicy(policy);
+        for (int i = 0; i < kStations; i++) {
+            manager.addStation(new KitchenStation(station_names[i]));
+            for (int s = 0; s < kSkus; s++) {
+                // Every third station runs short of one SKU, so some orders are refused
+                int quantity = (i % 3 == 0 && s == i % kSkus) ? 2 : 1000000;
+                manager.replenishIngredientAtStation(station_names[i], Ingredient("SKU " + std::to_string(s), quantity, 0, 1.0));
+            }
+            for (int d = 0; d < kDishesPerStation; d++) {
+                std::vector<Ingredient> ingredients;
+                for (int k = 0; k < 4; k++) {
+                    ingredients.emplace_back("SKU " + std::to_string((d + i + k * 7) % kSkus), 0, 1, 1.0);
+                }
+                manager.assignDishToStation(station_names[i], new Dish(dish_names[(d + i) % dish_names.size()], ingredients));
+            }
+        }
+
+        std::size_t sum = placeOrders(manager, dish_names, dish_symbols, station_names);  // Warm-up
+        const std::size_t before = g_allocations.load(std::memory_order_relaxed);
+        sum += placeOrders(manager, dish_names, dish_symbols, station_names);
+        const std::size_t allocations = g_allocations.load(std::memory_order_relaxed) - before;
+        g_sink = sum;
+
+        static const char* const kPolicyNames[] = {"NONE", "MOVE_TO_FRONT", "TRANSPOSE", "COUNT_ORDERED"};
+        std::cout << "policy " << kPolicyNames[policy] << ": " << allocations << " allocations after warm-up"
+                  << (allocations == 0 ? "" : " (FAILED: the order path must not allocate)") << "\n";
+        failed = failed || allocations != 0;
+
+        for (KitchenStation* station : manager) {
+            delete station;
+        }
+        manager.clear();
+    }
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}